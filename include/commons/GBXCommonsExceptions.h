@@ -31,4 +31,18 @@ public:
     ~FileLoaderException() = default;
 };
 
+class MappedFileException : public GBXCommonsException
+{
+public:
+    explicit MappedFileException(const std::string&);
+    ~MappedFileException() = default;
+};
+
+class SaveFileException : public GBXCommonsException
+{
+public:
+    explicit SaveFileException(const std::string&);
+    ~SaveFileException() = default;
+};
+
 }
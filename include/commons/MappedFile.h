@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <sstream>
+
+#include "GBXCommonsExceptions.h"
+
+namespace gbxcommons
+{
+
+// Read-only, private memory mapping of a whole file. Pages are only faulted in when touched and are shared
+// between every process (and every emulator instance) mapping the same file.
+class MappedFile
+{
+public:
+    MappedFile(std::string);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) noexcept;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) noexcept;
+
+    std::string FileName();
+    void Map();
+    [[nodiscard]] bool IsMapped();
+    [[nodiscard]] const uint8_t* Data();
+    [[nodiscard]] size_t Size();
+
+private:
+    void Unmap();
+
+    std::string _fileName{};
+    size_t _fileSize{};
+    void* _mapping{};
+};
+
+}
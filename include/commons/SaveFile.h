@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "GBXCommonsExceptions.h"
+
+namespace gbxcommons
+{
+
+const size_t SaveFileBlockSize = 0x100;
+
+// Read-write, shared memory mapping of a save file. Writes land in the page cache as they are made, so they outlive
+// a crash of the process; the blocks marked dirty are synced to disk by a background flusher and on destruction.
+class SaveFile
+{
+public:
+    SaveFile(std::string, size_t);
+    ~SaveFile();
+
+    SaveFile(const SaveFile&) = delete;
+    SaveFile& operator=(const SaveFile&) = delete;
+
+    std::string FileName();
+    [[nodiscard]] uint8_t* Data();
+    [[nodiscard]] size_t Size();
+
+    void MarkDirty(size_t);
+    [[nodiscard]] size_t DirtyBlockCount();
+    void Flush();
+
+    void StartFlushing(std::chrono::milliseconds = std::chrono::milliseconds(1000));
+    void StopFlushing();
+    [[nodiscard]] bool IsFlushing();
+
+private:
+    inline void RunFlusher();
+    inline void SyncBlocks(size_t, size_t);
+
+    std::string _fileName{};
+    size_t _size{};
+    uint8_t* _mapping{};
+    std::vector<std::atomic<uint64_t>> _dirtyBlocks;
+
+    std::atomic<bool> _flushing{};
+    std::chrono::milliseconds _interval{};
+    std::mutex _wakeUpMutex;
+    std::condition_variable _wakeUp;
+    std::unique_ptr<std::thread> _flusher;
+};
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace gbxcore
 {
 
@@ -33,4 +35,6 @@ enum class AddressingMode
     SubRoutineCall,
 };
 
+constexpr size_t AddressingModeCount = static_cast<size_t>(AddressingMode::SubRoutineCall) + 1;
+
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "AddressingMode.h"
+
 namespace gbxcore
 {
 
@@ -33,32 +35,740 @@ struct AddressingModeFormat
 class AddressingModeTemplate
 {
 public:
-    static AddressingModeFormat NoAddressingMode;
-    static AddressingModeFormat RegisterAddressingMode;
-    static AddressingModeFormat ImmediateAddressingMode;
-    static AddressingModeFormat RegisterIndexedSourceAddressingMode;
-    static AddressingModeFormat RegisterIndexedDestinationAddressingMode;
-    static AddressingModeFormat RegisterIndirectSourceAddressingMode;
-    static AddressingModeFormat RegisterIndirectDestinationAddressingMode;
-    static AddressingModeFormat RegisterExtendedSourceAddressingMode;
-    static AddressingModeFormat RegisterExtendedDestinationAddressingMode;
-    static AddressingModeFormat ImmediateRegisterIndirectAddressingMode;
-    static AddressingModeFormat ImmediateRegisterIndirectSourceIncrementAddressingMode;
-    static AddressingModeFormat ImmediateRegisterIndirectSourceDecrementAddressingMode;
-    static AddressingModeFormat ImmediateRegisterIndirectDestinationIncrementAddressingMode;
-    static AddressingModeFormat ImmediateRegisterIndirectDestinationDecrementAddressingMode;
-    static AddressingModeFormat ImplicitRegisterSourceAddressingMode;
-    static AddressingModeFormat ImplicitRegisterDestinationAddressingMode;
-    static AddressingModeFormat ImplicitImmediateSourceAddressingMode;
-    static AddressingModeFormat ImplicitImmediateDestinationAddressingMode;
-    static AddressingModeFormat ImmediatePairAddressingMode;
-    static AddressingModeFormat RegisterPairAddressingMode;
-    static AddressingModeFormat RegisterIndirectSourceAndDestinationAddressingMode;
-    static AddressingModeFormat RegisterIndirectDestinationPair;
-    static AddressingModeFormat RegisterIndirectSourcePair;
-    static AddressingModeFormat ExtendedDestinationPair;
-    static AddressingModeFormat SingleImmediatePairAddressingMode;
-    static AddressingModeFormat SubRoutineCallMode;
+    constexpr static AddressingModeFormat NoAddressingMode
+    {
+        .acquireOperand1 = false,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat RegisterAddressingMode
+    {
+        .acquireOperand1 = false,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat ImmediateAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = true,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat SingleImmediatePairAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = true,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat RegisterIndexedSourceAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = true,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = true,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = true,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat RegisterIndexedDestinationAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = true,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = true,
+        .writeBackAtOperandAddress = true,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat RegisterIndirectSourceAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = true,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat RegisterIndirectDestinationAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = true,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = true,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat RegisterExtendedSourceAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = true,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = true,
+        .acquireOperand2FromPc = true,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = true,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat RegisterExtendedDestinationAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = true,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = true,
+        .acquireOperand2FromPc = true,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = true,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = true,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat ImmediateRegisterIndirectAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = true,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = true,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = true,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat ImmediateRegisterIndirectSourceIncrementAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = true,
+        .incrementSource = true,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat ImmediateRegisterIndirectSourceDecrementAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = true,
+        .incrementSource = false,
+        .decrementSource = true,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat ImmediateRegisterIndirectDestinationIncrementAddressingMode
+    {
+        .acquireOperand1 = false,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = true,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = true,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = true,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat ImmediateRegisterIndirectDestinationDecrementAddressingMode
+    {
+        .acquireOperand1 = false,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = true,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = true,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = true,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat ImplicitRegisterSourceAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = true,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat ImplicitRegisterDestinationAddressingMode
+    {
+        .acquireOperand1 = false,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = true,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = true,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat ImplicitImmediateSourceAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = true,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = true,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = true,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat ImplicitImmediateDestinationAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = true,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = true,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = true,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat ImmediatePairAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = true,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = true,
+        .acquireOperand2FromPc = true,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat RegisterPairAddressingMode
+    {
+        .acquireOperand1 = false,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat RegisterIndirectSourceAndDestinationAddressingMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = true,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = true,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = true,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat RegisterIndirectDestinationPair
+    {
+        .acquireOperand1 = false,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = false,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = true,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = true,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat RegisterIndirectSourcePair
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = false,
+        .acquireOperand1Directly = true,
+        .incrementSource = true,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = true,
+        .acquireOperand2FromPc = false,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = true,
+        .incrementSourceOperand2 = true,
+        .acquireOperand3 = false,
+        .writeBack = false,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static AddressingModeFormat ExtendedDestinationPair
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = true,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = true,
+        .acquireOperand2FromPc = true,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = true,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = false,
+        .writeBackPairAtImmediateAddress = true
+    };
+
+    constexpr static AddressingModeFormat SubRoutineCallMode
+    {
+        .acquireOperand1 = true,
+        .acquireOperand1FromPc = true,
+        .acquireOperand1Directly = false,
+        .incrementSource = false,
+        .decrementSource = false,
+        .incrementDestination = false,
+        .decrementDestination = false,
+        .acquireOperand1Implicitly = false,
+        .acquireOperand2 = true,
+        .acquireOperand2FromPc = true,
+        .acquireOperand2AtComposedAddress = false,
+        .acquireOperand2Implicitly = false,
+        .acquireOperand2Directly = false,
+        .incrementSourceOperand2 = false,
+        .acquireOperand3 = false,
+        .writeBack = true,
+        .writeBackAtOperandAddress = false,
+        .writeBackAtRegisterAddress = false,
+        .writeBackAtComposedOperandAddress = false,
+        .writeBackAtImplicitlyWithRegister = false,
+        .writeBackAtImplicitlyWithImmediateOperand = false,
+        .writeBackPairAtRegisterAddress = true,
+        .writeBackPairAtImmediateAddress = false
+    };
+
+    constexpr static const AddressingModeFormat* Of(AddressingMode mode)
+    {
+        switch (mode)
+        {
+            case AddressingMode::Register: return &RegisterAddressingMode;
+            case AddressingMode::Immediate: return &ImmediateAddressingMode;
+            case AddressingMode::SingleImmediatePair: return &SingleImmediatePairAddressingMode;
+            case AddressingMode::RegisterIndexedSource: return &RegisterIndexedSourceAddressingMode;
+            case AddressingMode::RegisterIndexedDestination: return &RegisterIndexedDestinationAddressingMode;
+            case AddressingMode::RegisterIndirectSource: return &RegisterIndirectSourceAddressingMode;
+            case AddressingMode::RegisterIndirectDestination: return &RegisterIndirectDestinationAddressingMode;
+            case AddressingMode::RegisterIndirectSourceAndDestination: return &RegisterIndirectSourceAndDestinationAddressingMode;
+            case AddressingMode::ExtendedSource: return &RegisterExtendedSourceAddressingMode;
+            case AddressingMode::ExtendedDestination: return &RegisterExtendedDestinationAddressingMode;
+            case AddressingMode::ImmediateRegisterIndirect: return &ImmediateRegisterIndirectAddressingMode;
+            case AddressingMode::RegisterIndirectSourceIncrement: return &ImmediateRegisterIndirectSourceIncrementAddressingMode;
+            case AddressingMode::RegisterIndirectSourceDecrement: return &ImmediateRegisterIndirectSourceDecrementAddressingMode;
+            case AddressingMode::RegisterIndirectDestinationIncrement: return &ImmediateRegisterIndirectDestinationIncrementAddressingMode;
+            case AddressingMode::RegisterIndirectDestinationDecrement: return &ImmediateRegisterIndirectDestinationDecrementAddressingMode;
+            case AddressingMode::RegisterImplicitSource: return &ImplicitRegisterSourceAddressingMode;
+            case AddressingMode::RegisterImplicitDestination: return &ImplicitRegisterDestinationAddressingMode;
+            case AddressingMode::ImmediateImplicitSource: return &ImplicitImmediateSourceAddressingMode;
+            case AddressingMode::ImmediateImplicitDestination: return &ImplicitImmediateDestinationAddressingMode;
+            case AddressingMode::ImmediatePair: return &ImmediatePairAddressingMode;
+            case AddressingMode::RegisterPair: return &RegisterPairAddressingMode;
+            case AddressingMode::RegisterIndirectDestinationPair: return &RegisterIndirectDestinationPair;
+            case AddressingMode::RegisterIndirectSourcePair: return &RegisterIndirectSourcePair;
+            case AddressingMode::ExtendedDestinationPair: return &ExtendedDestinationPair;
+            case AddressingMode::SubRoutineCall: return &SubRoutineCallMode;
+            default: return nullptr;
+        }
+    }
 };
 
 }
\ No newline at end of file
@@ -4,6 +4,9 @@
 
 #include "GBXCoreExceptions.h"
 #include "AddressingModeFormat.h"
+#include "DecodedInstructionCache.h"
+#include "InstructionCycles.h"
+#include "InstructionTrace.h"
 #include "InstructionUtilities.h"
 #include "OpcodeDecoder.h"
 #include "OpcodePatternMatcher.h"
@@ -15,6 +18,17 @@
 namespace gbxcore
 {
 
+typedef struct FetchedInstruction_t
+{
+    bool Pending;
+    PrivilegeMode Mode;
+    uint16_t Address;
+    uint8_t Length;
+    uint8_t PreOpcode;
+    uint8_t Opcode;
+}
+FetchedInstruction;
+
 class ArithmeticLogicUnit : public interfaces::ArithmeticLogicUnitInterface
 {
 public:
@@ -28,16 +42,25 @@ public:
     virtual void Execute() override;
 
     virtual void AcquireInstruction(interfaces::MemoryControllerInterface* memoryController) override;
+    [[nodiscard]] virtual interfaces::PredecodedInstruction PredecodeInstruction(interfaces::MemoryControllerInterface*, uint16_t) override;
+    virtual void LoadPredecodedInstruction(const interfaces::PredecodedInstruction&) override;
 
     [[nodiscard]] virtual bool ClearInterruptStatusSignal() override;
-    [[nodiscard]] virtual bool HaltSignal() override;
+    [[nodiscard]] virtual bool HaltSignal() override final { return _haltSignal; }
     [[nodiscard]] virtual bool StopSignal() override;
+    [[nodiscard]] virtual bool IllegalInstructionSignal() override final { return _illegalInstructionSignal; }
     [[nodiscard]] virtual bool InterruptMasterEnable() override;
     [[nodiscard]] virtual bool IsExecutionAborted() override;
     [[nodiscard]] virtual bool UserModeRequested() override;
     [[nodiscard]] virtual bool UserModeSourceOperandRequested() override;
+    [[nodiscard]] virtual uint64_t Cycles() override final { return _cycles; }
+    virtual void Stall(uint64_t cycles) override final { _cycles += cycles; }
+    virtual void RestoreCycles(uint64_t cycles) override final { _cycles = cycles; }
+    virtual void SuppressTracing(bool suppress) override final { _tracingSuppressed = suppress; }
 
-    virtual AddressingModeFormat* AcquireAddressingModeTraits() override;
+    virtual const AddressingModeFormat* AcquireAddressingModeTraits() override;
+    virtual AddressingMode AcquireAddressingMode() override;
+    virtual uint16_t AcquireProgramCounter() override;
     virtual void AcquireOperand1AtPC(interfaces::MemoryControllerInterface*) override;
     virtual void AcquireOperand1Implicitly(interfaces::MemoryControllerInterface*) override;
     virtual void AcquireOperand1AtRegister(interfaces::MemoryControllerInterface*) override;
@@ -56,19 +79,33 @@ public:
 
 protected:
     inline uint8_t ReadAtRegister(interfaces::Register, interfaces::MemoryControllerInterface*);
+    inline uint8_t ReadOperandAt(uint16_t, interfaces::MemoryControllerInterface*);
     inline void IncrementRegisterPair(interfaces::Register);
     inline void DecrementRegisterPair(interfaces::Register);
     inline void IncrementPC();
     inline static bool IsSuffixedInstruction(uint8_t);
+    inline void TraceInstruction(uint16_t, uint8_t, uint8_t);
     inline void ResolveExecutionSignals();
     inline void ResolveMemoryAccessSignals();
     inline void ClearExecutionSignals();
+    inline void AccountInstructionCycles();
+    inline const AddressingModeFormat* ResolveAddressingModeTraits();
+    inline void ObserveMemoryController(interfaces::MemoryControllerInterface*);
+    inline void CacheDecodedInstruction(uint8_t, uint8_t);
+    inline void SelectPredecodedInstruction(const interfaces::PredecodedInstruction&);
 
-    AddressingModeFormat* _currentAddressingMode;
+    const AddressingModeFormat* _currentAddressingMode;
     interfaces::DecodedInstruction _instructionData;
     instructions::OpcodeDecoder _decoder;
     interfaces::BaseInstructionInterface* _currentInstruction{};
     interfaces::RegisterBankInterface* _registers;
+
+    DecodedInstructionCache _decodeCache;
+    DecodedInstructionCacheEntry* _cachedInstruction{};
+    FetchedInstruction _fetchedInstruction{};
+    uint64_t _cycles{};
+    bool _tracingSuppressed{};
+    interfaces::MemoryControllerInterface* _observedMemoryController{};
     
     bool _userModeRequested{};
     bool _userModeSourceOperandRequested{};
@@ -76,6 +113,7 @@ protected:
     bool _clearInterruptStatusSignal{};
     bool _haltSignal{};
     bool _stopSignal{};
+    bool _illegalInstructionSignal{};
     bool _interruptMasterEnable{};
 };
 
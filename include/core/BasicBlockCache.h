@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "AddressRange.h"
+#include "ArithmeticLogicUnitInterface.h"
+#include "ControlUnit.h"
+#include "GBXCoreExceptions.h"
+#include "MemoryObserver.h"
+#include "SystemMode.h"
+
+namespace gbxcore
+{
+
+typedef struct BasicBlockInstruction_t
+{
+    ControlUnit::ExecutionPath Handler;
+    interfaces::PredecodedInstruction Predecoded;
+}
+BasicBlockInstruction;
+
+typedef struct BasicBlock_t
+{
+    bool Valid;
+    PrivilegeMode Mode;
+    uint16_t Begin;
+    uint16_t End;
+    std::vector<BasicBlockInstruction> Instructions;
+    size_t Executions;
+    std::weak_ptr<BasicBlock_t> Successor;
+    bool Interpreted;
+}
+BasicBlock;
+
+class BasicBlockCache : public interfaces::MemoryObserver
+{
+public:
+    BasicBlockCache() = default;
+    virtual ~BasicBlockCache() = default;
+
+    [[nodiscard]] std::shared_ptr<BasicBlock> Lookup(PrivilegeMode, uint16_t);
+    void Insert(std::shared_ptr<BasicBlock>);
+    void Flush();
+    [[nodiscard]] size_t Size();
+    [[nodiscard]] size_t Overwrites(PrivilegeMode, uint16_t);
+
+    virtual void OnWrite(size_t) override;
+    virtual void OnBankSwitch(PrivilegeMode, AddressRange, size_t) override;
+    virtual void OnInvalidate() override;
+
+    constexpr static size_t PageSize = 0x100;
+    constexpr static size_t PageCount = 0x10000 / PageSize;
+
+private:
+    inline static size_t KeyOf(PrivilegeMode, uint16_t);
+    inline void Invalidate(std::shared_ptr<BasicBlock>&);
+    inline static bool SharesMode(PrivilegeMode, PrivilegeMode);
+
+    std::unordered_map<size_t, std::shared_ptr<BasicBlock>> _blocks;
+    std::unordered_map<size_t, size_t> _overwrites;
+    std::array<std::vector<std::shared_ptr<BasicBlock>>, PageCount> _pages;
+};
+
+}
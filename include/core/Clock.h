@@ -26,6 +26,7 @@ public:
     Clock& operator=(Clock&&) = default;
 
     void Tick(uint64_t, uint64_t);
+    virtual void Advance(uint64_t) override;
 
     double Period() const;
     virtual uint64_t Ticks() const override;
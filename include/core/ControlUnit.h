@@ -1,12 +1,15 @@
 #pragma once
 
+#include <array>
 #include <memory>
 #include <optional>
+#include <utility>
 #include <variant>
 #include <sstream>
 
 #include <iostream>
 
+#include "AddressingMode.h"
 #include "AddressingModeFormat.h"
 #include "GBXCoreExceptions.h"
 #include "RegisterBank.h"
@@ -20,27 +23,34 @@ namespace gbxcore
 class ControlUnit : public std::enable_shared_from_this<ControlUnit>, public interfaces::ControlUnitInterface
 {
 public:
+    typedef void (ControlUnit::*ExecutionPath)();
+
     ControlUnit();
     virtual ~ControlUnit() = default;
     virtual void RunCycle() override;
+    virtual size_t RunBounded(const interfaces::ExecutionBounds&) override;
 
     virtual void Initialize(interfaces::MemoryControllerInterface*,
                             interfaces::ArithmeticLogicUnitInterface*) override;
 
 protected:
+    template<AddressingMode Mode, bool Predecoded> void RunExecutionPath();
+    template<bool Predecoded, size_t ...Modes> constexpr static std::array<ExecutionPath, sizeof...(Modes)> BuildExecutionPaths(std::index_sequence<Modes...>);
+    constexpr static AddressingModeFormat TraitsOf(AddressingMode);
+
     inline void Fetch();
     inline void Decode();
     inline void Execute();
-    inline void AcquireOperand1();
-    inline void AcquireOperand2();
+    template<AddressingMode Mode, bool Predecoded> inline void AcquireOperand1();
+    template<AddressingMode Mode, bool Predecoded> inline void AcquireOperand2();
     inline void AcquireOperand3();
-    inline void WriteBack();
+    template<AddressingMode Mode> inline void WriteBack();
 
     inline void AcquireAddressingMode();
     inline void InitializeRegisters();
     inline void DecodeInstruction();
     inline void ExecuteInstruction();
-    inline void WriteBackResults();
+    template<AddressingMode Mode> inline void WriteBackResults();
     inline void ReadOperand1AtPC();
     inline void ReadOperand1AtRegister();
     inline void ReadOperand1Implicitly();
@@ -60,12 +70,15 @@ protected:
 
     inline bool IsExecutionAborted();
     inline bool IsUserModeRequested();
-    inline bool IsUserSourceOperandModeRequested();
 
     interfaces::ArithmeticLogicUnitInterface*  _alu;
     interfaces::MemoryControllerInterface* _memoryController;
+    interfaces::MemoryControllerInterface* _instructionMemoryController;
     std::optional<uint8_t> _preOpcode;
-    AddressingModeFormat* _currentAddressingMode;   
+    ExecutionPath _executionPath;
+
+    static const std::array<ExecutionPath, AddressingModeCount> ExecutionPaths;
+    static const std::array<ExecutionPath, AddressingModeCount> PredecodedExecutionPaths;
 
     std::once_flag _flag;
 };
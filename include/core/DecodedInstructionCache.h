@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "AddressingModeFormat.h"
+#include "AddressRange.h"
+#include "ArithmeticLogicUnitInterface.h"
+#include "InstructionInterface.h"
+#include "MemoryObserver.h"
+#include "SystemMode.h"
+
+namespace gbxcore
+{
+
+typedef struct DecodedInstructionCacheEntry_t
+{
+    bool Valid;
+    PrivilegeMode Mode;
+    size_t Bank;
+    uint16_t Address;
+    interfaces::PredecodedInstruction Predecoded;
+}
+DecodedInstructionCacheEntry;
+
+typedef struct ActiveBank_t
+{
+    PrivilegeMode Mode;
+    size_t Begin;
+    size_t End;
+    size_t Bank;
+}
+ActiveBank;
+
+class DecodedInstructionCache : public interfaces::MemoryObserver
+{
+public:
+    DecodedInstructionCache() = default;
+    virtual ~DecodedInstructionCache() = default;
+
+    [[nodiscard]] DecodedInstructionCacheEntry* Lookup(PrivilegeMode, uint16_t);
+    DecodedInstructionCacheEntry& Allocate(PrivilegeMode, uint16_t);
+    void Flush();
+
+    virtual void OnWrite(size_t) override;
+    virtual void OnBankSwitch(PrivilegeMode, AddressRange, size_t) override;
+    virtual void OnInvalidate() override;
+
+    constexpr static size_t CacheSize = 0x1000;
+
+private:
+    inline size_t BankAt(PrivilegeMode, uint16_t);
+    inline void InvalidateAt(size_t, uint8_t);
+
+    std::array<DecodedInstructionCacheEntry, CacheSize> _entries{};
+    std::vector<ActiveBank> _activeBanks;
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace gbxcore
+{
+
+typedef std::function<void(uint64_t)> ScheduledEvent;
+typedef uint64_t EventHandle;
+
+typedef struct PendingEvent_t
+{
+    uint64_t Cycle;
+    EventHandle Handle;
+    ScheduledEvent Event;
+}
+PendingEvent;
+
+// Min-heap of "fire at cycle N" callbacks. The CPU only compares its cycle counter against NextEventCycle after each
+// instruction; peripherals are run when (and only when) one of their events is due. Events due at the same cycle fire
+// in the order they were scheduled, and receive the cycle they were scheduled for.
+class EventScheduler
+{
+public:
+    EventScheduler() = default;
+    ~EventScheduler() = default;
+
+    EventHandle Schedule(uint64_t, ScheduledEvent);
+    void Cancel(EventHandle);
+    void RunDue(uint64_t);
+
+    [[nodiscard]] uint64_t NextEventCycle() const { return _nextEventCycle; }
+    [[nodiscard]] size_t PendingEventCount() const;
+
+    constexpr static uint64_t NoPendingEvent = std::numeric_limits<uint64_t>::max();
+
+private:
+    inline void UpdateNextEventCycle();
+    inline static bool FiresLater(const PendingEvent&, const PendingEvent&);
+
+    std::vector<PendingEvent> _events;
+    EventHandle _nextHandle{};
+    uint64_t _nextEventCycle{NoPendingEvent};
+};
+
+}
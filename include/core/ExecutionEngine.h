@@ -0,0 +1,19 @@
+#pragma once
+
+namespace gbxcore
+{
+
+enum class ExecutionEngine
+{
+    Interpreter,
+    ThreadedInterpreter,
+    Tiered,
+};
+
+enum class ExecutionValidation
+{
+    None,
+    Lockstep,
+};
+
+}
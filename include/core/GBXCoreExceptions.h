@@ -80,4 +80,18 @@ public:
     ~VideoOutputException() = default;
 };
 
+class ControlUnitException : public GBXCoreException
+{
+public:
+    explicit ControlUnitException(const std::string&);
+    ~ControlUnitException() = default;
+};
+
+class TraceException : public GBXCoreException
+{
+public:
+    explicit TraceException(const std::string&);
+    ~TraceException() = default;
+};
+
 }
\ No newline at end of file
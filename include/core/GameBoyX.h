@@ -1,25 +1,35 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <variant>
 
 #include "ArithmeticLogicUnit.h"
 #include "BankedROM.h"
+#include "BatteryBackedRAM.h"
+#include "CGBHDMAAddressRegister.h"
+#include "CGBHDMAControlRegister.h"
 #include "Clock.h"
 #include "ControlUnit.h"
 #include "DMGAndGBCRegisterAddresses.h"
-#include "FileLoader.h"
+#include "ExecutionEngine.h"
+#include "MappedFile.h"
+#include "MemoryBankControllers.h"
 #include "MemoryController.h"
+#include "OAMDMARegister.h"
 #include "OpenGLVideoOutput.h"
 #include "LCDVideoController.h"
 #include "LCDControlRegister.h"
 #include "RAM.h"
 #include "RegisterBank.h"
 #include "ROM.h"
+#include "ROMImageRegistry.h"
 #include "Runtime.h"
 #include "SystemConstants.h"
 #include "SystemMode.h"
+#include "ThreadedControlUnit.h"
+#include "TieredControlUnit.h"
 #include "Z80X.h"
 
 namespace gbxcore
@@ -28,11 +38,22 @@ namespace gbxcore
 class GameBoyX : public interfaces::Runtime
 {
 public:
-    GameBoyX();
+    explicit GameBoyX(ExecutionEngine = ExecutionEngine::Interpreter, ExecutionValidation = ExecutionValidation::None);
     virtual ~GameBoyX() = default;
     void Run() override;
+    interfaces::StopReason RunFor(uint64_t, interfaces::CancellationCheck = nullptr) override;
+    interfaces::StopReason RunInstructions(uint64_t, interfaces::CancellationCheck = nullptr) override;
+    interfaces::StopReason RunFrame(interfaces::CancellationCheck = nullptr) override;
+
+    void SetBreakpoint(uint16_t) override;
+    void ClearBreakpoint(uint16_t) override;
+    [[nodiscard]] const std::string& LastError() const override;
+    [[nodiscard]] uint64_t Instructions() const override;
+    [[nodiscard]] uint64_t Cycles() const;
+
     void LoadGame(std::string) override;
     void LoadBIOS(std::string) override;
+    void AttachSaveFile(std::string, std::chrono::milliseconds = std::chrono::milliseconds(1000));
 
     gbxcore::SecurityLevel SecurityLevel() override;
     void SetSecurityLevel(gbxcore::SecurityLevel) override;
@@ -43,20 +64,27 @@ public:
     std::variant<uint8_t, uint16_t> ReadRegister(interfaces::Register) override;
 
 private:
+    std::unique_ptr<ControlUnit> CreateControlUnit(ExecutionEngine, ExecutionValidation, interfaces::RegisterBankInterface*);
     void LoadROMBinary(std::string);
     void LoadBIOSBinary(std::string);
 
-    void LoadStaticROMSection(uint8_t*, size_t);
-    void LoadDynamicROMSection(uint8_t*, size_t);
+    void MapStaticROMSection(memory::ROMImage);
+    void MapDynamicROMSection(memory::ROMImage);
+    void AttachMemoryBankController(memory::ROMImage);
+    void ScheduleHBlank(uint64_t);
 
     gbxcore::SecurityLevel _level{};    
 
 protected:
     bool IsPair(interfaces::Register);
 
-    Z80X _cpu;
+    NativeZ80X _cpu;
     memory::MemoryController* _memoryControllerPtr;
     RegisterBank* _registersPtr;
+    memory::BankedROM* _userBankedROMPtr;
+    memory::BatteryBackedRAM* _userExternalRAMPtr;
+    size_t _externalRAMSize{};
+    memory::registers::CGBHDMAControlRegister* _hdmaControlRegisterPtr;
     std::unique_ptr<gbxcore::video::LCDVideoController> _videoController;
 };
 
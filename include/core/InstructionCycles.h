@@ -0,0 +1,109 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "AddressingMode.h"
+#include "AddressingModeFormat.h"
+#include "Opcodes.h"
+
+namespace gbxcore
+{
+
+// Machine cycles of an instruction, excluding its prefix byte. 'NotTaken' only differs from 'Taken' for
+// conditional branches whose condition did not hold (i.e. whose execution was aborted).
+typedef struct InstructionCycles_t
+{
+    uint8_t Taken;
+    uint8_t NotTaken;
+}
+InstructionCycles;
+
+typedef std::array<std::array<InstructionCycles, AddressingModeCount>, instructions::OpcodeTypeCount> InstructionCycleTable;
+
+class InstructionCycleTemplate
+{
+public:
+    // One cycle for the opcode fetch plus one for each memory access performed by the addressing mode
+    constexpr static uint8_t AccessCyclesOf(AddressingMode mode)
+    {
+        auto traits = AddressingModeTemplate::Of(mode);
+        if (traits == nullptr)
+            return 1;
+
+        auto operand1 = traits->acquireOperand1 && (traits->acquireOperand1FromPc || traits->acquireOperand1Directly || traits->acquireOperand1Implicitly);
+        auto operand2 = traits->acquireOperand2 && (traits->acquireOperand2FromPc || traits->acquireOperand2AtComposedAddress || traits->acquireOperand2Implicitly || traits->acquireOperand2Directly);
+
+        return static_cast<uint8_t>(1 + operand1 + operand2 + traits->acquireOperand3 + WriteBackCyclesOf(mode));
+    }
+
+    constexpr static uint8_t WriteBackCyclesOf(AddressingMode mode)
+    {
+        auto traits = AddressingModeTemplate::Of(mode);
+        if (traits == nullptr || !traits->writeBack)
+            return 0;
+
+        return (traits->writeBackPairAtRegisterAddress || traits->writeBackPairAtImmediateAddress)? 2 : 1;
+    }
+
+    constexpr static InstructionCycles Of(instructions::OpcodeType opcode, AddressingMode mode)
+    {
+        using instructions::OpcodeType;
+        auto cycles = AccessCyclesOf(mode);
+
+        switch (opcode)
+        {
+            // JP (HL) loads PC straight from HL, without any memory access
+            case OpcodeType::jp:
+                if (mode == AddressingMode::RegisterIndirectSourcePair)
+                    return Unconditional(1);
+                [[fallthrough]];
+            // Taken branches spend an internal cycle loading PC
+            case OpcodeType::jpu:
+            case OpcodeType::jr: return {static_cast<uint8_t>(cycles + 1), cycles};
+            // A call not taken neither pushes the return address nor loads PC
+            case OpcodeType::call: return {static_cast<uint8_t>(cycles + 1), static_cast<uint8_t>(cycles - WriteBackCyclesOf(mode))};
+            // A ret not taken only spends the condition check. Costs are those of an unconditional ret; a taken
+            // conditional one also pays ConditionalReturnCycles
+            case OpcodeType::ret: return {static_cast<uint8_t>(cycles + 1), 2};
+            case OpcodeType::reti:
+            case OpcodeType::rst:
+            case OpcodeType::push:
+            case OpcodeType::ldhl: return Unconditional(cycles + 1);
+            // add SP, e spends two internal cycles on the 16-bit addition
+            case OpcodeType::add:
+                if (mode == AddressingMode::SingleImmediatePair)
+                    return Unconditional(cycles + 2);
+                [[fallthrough]];
+            // 16-bit register transfers and arithmetic go through the address bus
+            default: return Unconditional(cycles + (mode == AddressingMode::RegisterPair? 1 : 0));
+        }
+    }
+
+private:
+    constexpr static InstructionCycles Unconditional(uint8_t cycles)
+    {
+        return {cycles, cycles};
+    }
+};
+
+constexpr InstructionCycleTable BuildInstructionCycleTable()
+{
+    InstructionCycleTable table{};
+
+    for (auto opcode = static_cast<size_t>(0); opcode < instructions::OpcodeTypeCount; ++opcode)
+        for (auto mode = static_cast<size_t>(0); mode < AddressingModeCount; ++mode)
+            table[opcode][mode] = InstructionCycleTemplate::Of(static_cast<instructions::OpcodeType>(opcode), static_cast<AddressingMode>(mode));
+
+    return table;
+}
+
+constexpr InstructionCycleTable InstructionCycleCosts = BuildInstructionCycleTable();
+
+// Prefixed (CB, DD, FD, FC) instructions spend one extra cycle fetching the prefix byte
+constexpr uint8_t PrefixCycles = 1;
+
+// A taken conditional ret spends one more cycle than an unconditional ret, evaluating its condition
+constexpr uint8_t ConditionalReturnCycles = 1;
+
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GBXCoreExceptions.h"
+#include "TraceLevel.h"
+
+namespace gbxcore
+{
+
+typedef struct TraceRecord_t
+{
+    uint64_t Cycle;
+    uint16_t Address;
+    uint8_t PreOpcode;
+    uint8_t Opcode;
+    uint32_t Thread;
+}
+TraceRecord;
+
+typedef struct TraceFileHeader_t
+{
+    std::array<char, 4> Magic;
+    uint16_t Version;
+    uint16_t RecordSize;
+}
+TraceFileHeader;
+
+static_assert(sizeof(TraceRecord) == 16, "trace records must keep their on-disk size");
+
+constexpr TraceFileHeader InstructionTraceFileHeader
+{
+    .Magic = {'G', 'B', 'X', 'T'},
+    .Version = 1,
+    .RecordSize = sizeof(TraceRecord)
+};
+
+// Single-producer/single-consumer ring: the emulation thread pushes, the writer thread drains
+class TraceRing
+{
+public:
+    TraceRing() = default;
+    ~TraceRing() = default;
+
+    TraceRing(const TraceRing&) = delete;
+    TraceRing& operator=(const TraceRing&) = delete;
+
+    bool Push(const TraceRecord&);
+    size_t Drain(std::vector<TraceRecord>&);
+    size_t Dropped();
+
+    constexpr static size_t Capacity = 0x4000;
+
+private:
+    std::array<TraceRecord, Capacity> _records{};
+    alignas(64) std::atomic<size_t> _head{};
+    alignas(64) std::atomic<size_t> _tail{};
+    std::atomic<size_t> _dropped{};
+};
+
+class InstructionTracer
+{
+public:
+    ~InstructionTracer();
+    [[nodiscard]] static InstructionTracer& Instance();
+
+    void Start(std::string, std::chrono::milliseconds = std::chrono::milliseconds(10));
+    void Stop();
+    [[nodiscard]] bool IsRecording();
+    [[nodiscard]] size_t Dropped();
+
+    void Record(TraceRecord);
+
+private:
+    InstructionTracer() = default;
+
+    inline TraceRing* AcquireRing();
+    inline void RunWriter();
+    inline void DrainRings();
+
+    std::atomic<bool> _recording{};
+    std::vector<std::unique_ptr<TraceRing>> _rings;
+    std::vector<TraceRecord> _pending;
+    std::mutex _ringsMutex;
+    std::condition_variable _wakeUp;
+    std::unique_ptr<std::thread> _writer;
+    std::ofstream _file;
+    std::chrono::milliseconds _interval{};
+};
+
+class TraceFileReader
+{
+public:
+    explicit TraceFileReader(std::string);
+    ~TraceFileReader() = default;
+
+    [[nodiscard]] std::vector<TraceRecord> ReadAll();
+
+private:
+    std::ifstream _file;
+};
+
+}
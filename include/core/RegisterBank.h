@@ -14,51 +14,176 @@ namespace gbxcore
 {
 
 const size_t RegisterBankSizeInBytes = 20;
+const size_t RegisterCount = static_cast<size_t>(interfaces::Register::NoRegister) + 1;
+const uint8_t InvalidRegisterIndex = 0xFF;
 
-class RegisterBank : public interfaces::RegisterBankInterface 
+enum class FlagEvaluation
+{
+    Eager,
+    Lazy
+};
+
+typedef struct DeferredFlags_t
+{
+    interfaces::FlagOperation Operation;
+    uint8_t Operand1;
+    uint8_t Operand2;
+    uint8_t Carry;
+}
+DeferredFlags;
+
+typedef struct RegisterPairIndices_t
+{
+    uint8_t High;
+    uint8_t Low;
+}
+RegisterPairIndices;
+
+constexpr std::array<RegisterPairIndices, RegisterCount> BuildRegisterPairIndices()
+{
+    using interfaces::Register;
+
+    std::array<RegisterPairIndices, RegisterCount> table{};
+    std::fill(table.begin(), table.end(), RegisterPairIndices{.High = InvalidRegisterIndex, .Low = InvalidRegisterIndex});
+
+    auto pair = [&table](Register pair, uint8_t high, uint8_t low) { table[static_cast<size_t>(pair)] = {.High = high, .Low = low}; };
+    pair(Register::HL, static_cast<uint8_t>(Register::H), static_cast<uint8_t>(Register::L));
+    pair(Register::DE, static_cast<uint8_t>(Register::D), static_cast<uint8_t>(Register::E));
+    pair(Register::BC, static_cast<uint8_t>(Register::B), static_cast<uint8_t>(Register::C));
+    pair(Register::AF, static_cast<uint8_t>(Register::A), static_cast<uint8_t>(Register::F));
+    pair(Register::PC, static_cast<uint8_t>(Register::PC), static_cast<uint8_t>(Register::PC) + 1);
+    pair(Register::SP, static_cast<uint8_t>(Register::SP), static_cast<uint8_t>(Register::SP) + 1);
+    pair(Register::IX, static_cast<uint8_t>(Register::IX), static_cast<uint8_t>(Register::IX) + 1);
+    pair(Register::IY, static_cast<uint8_t>(Register::IY), static_cast<uint8_t>(Register::IY) + 1);
+    return table;
+}
+
+constexpr std::array<RegisterPairIndices, RegisterCount> RegisterPairIndexTable = BuildRegisterPairIndices();
+
+class RegisterBank final : public interfaces::RegisterBankInterface 
 {
 public: 
-    RegisterBank();
+    explicit RegisterBank(FlagEvaluation = FlagEvaluation::Lazy);
     virtual ~RegisterBank() = default;
 
-    std::uint8_t Read(interfaces::Register);
-    std::uint16_t ReadPair(interfaces::Register);
+    inline std::uint8_t Read(interfaces::Register reg)
+    {
+        assert(IsSingleRegister(reg));
+
+        if (reg == interfaces::Register::F)
+            MaterializeFlags();
+
+        return _registers[RegisterToIndex(reg)];
+    }
+
+    inline std::uint16_t ReadPair(interfaces::Register reg)
+    {
+        assert(!IsSingleRegister(reg));
+
+        if (reg == interfaces::Register::AF)
+            MaterializeFlags();
+
+        auto indices = PairToIndices(reg);
+        return static_cast<uint16_t>(_registers[indices.High] << 8 | _registers[indices.Low]);
+    }
+
+    inline void Write(interfaces::Register reg, std::uint8_t val)
+    {
+        assert(IsSingleRegister(reg));
+
+        if (reg == interfaces::Register::F)
+            _flagsDeferred = false;
+
+        if (IsSingleRegister(reg))
+            _registers[RegisterToIndex(reg)] = val;
+        else
+            WritePair(reg, val);
+    }
+
+    inline void WritePair(interfaces::Register reg, std::uint16_t val)
+    {
+        assert(!IsSingleRegister(reg));
+
+        auto indices = PairToIndices(reg);
 
-    void Write(interfaces::Register, std::uint8_t);
-    void WritePair(interfaces::Register, std::uint16_t);
+        if (reg == interfaces::Register::AF)
+            _flagsDeferred = false;
+
+        _registers[indices.High] = (val >> 8);
+        _registers[indices.Low] = val;
+    }
     
     inline void SetFlag(interfaces::Flag flag)
     {
+        MaterializeFlags();
         _registers[static_cast<uint8_t>(interfaces::Register::F)] |= 1 << static_cast<uint8_t>(flag);
     }
     
     inline void ClearFlag(interfaces::Flag flag)
     {
+        MaterializeFlags();
         _registers[static_cast<uint8_t>(interfaces::Register::F)] &= ~(1 << static_cast<uint8_t>(flag));
     }
 
     inline uint8_t ReadFlag(interfaces::Flag flag)
     {
+        if (_flagsDeferred)
+            return EvaluateFlag(flag);
+
         return ((_registers[static_cast<uint8_t>(interfaces::Register::F)] >> static_cast<uint8_t>(flag)) & 0x01);
     }
 
     inline void WriteFlag(interfaces::Flag flag, uint8_t value)
     {
+        MaterializeFlags();
         _registers[static_cast<uint8_t>(interfaces::Register::F)] &= ~(1 << static_cast<uint8_t>(flag));
         _registers[static_cast<uint8_t>(interfaces::Register::F)] |= value << static_cast<uint8_t>(flag);
     }
+
+    void DeferFlags(interfaces::FlagOperation, uint8_t, uint8_t, uint8_t);
+
+    [[nodiscard]] FlagEvaluation Evaluation() const;
+    void SetEvaluation(FlagEvaluation);
     
 private:
-    constexpr uint8_t RegisterToIndex(interfaces::Register);
-    constexpr bool IsSingleRegister(interfaces::Register);
+    inline void MaterializeFlags()
+    {
+        if (_flagsDeferred)
+            EvaluateDeferredFlags();
+    }
 
-    inline void Swap();
+    void EvaluateDeferredFlags();
+    uint8_t EvaluateFlag(interfaces::Flag);
 
-    inline uint8_t PairToHighIndex(interfaces::Register);
-    inline uint8_t PairToLowIndex(interfaces::Register);
+    constexpr static uint8_t RegisterToIndex(interfaces::Register reg)
+    {
+        return static_cast<uint8_t>(reg);
+    }
+
+    constexpr static bool IsSingleRegister(interfaces::Register reg)
+    {
+        return RegisterPairIndexTable[static_cast<size_t>(reg)].High == InvalidRegisterIndex;
+    }
+
+    inline static RegisterPairIndices PairToIndices(interfaces::Register reg)
+    {
+        auto index = static_cast<size_t>(reg);
+        if (index >= RegisterCount || RegisterPairIndexTable[index].High == InvalidRegisterIndex)
+            ThrowInvalidPair();
+
+        return RegisterPairIndexTable[index];
+    }
+
+    [[noreturn]] static void ThrowInvalidPair();
+
+    inline void Swap();
 
     std::array<std::uint8_t, RegisterBankSizeInBytes> _registers;
     std::array<std::uint8_t, RegisterBankSizeInBytes> _alternates;
+
+    FlagEvaluation _evaluation;
+    DeferredFlags _deferredFlags{};
+    bool _flagsDeferred{};
 };
 
 }
\ No newline at end of file
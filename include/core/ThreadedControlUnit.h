@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+
+#include "ArithmeticLogicUnitInterface.h"
+#include "BasicBlockCache.h"
+#include "ControlUnit.h"
+#include "GBXCoreExceptions.h"
+#include "MemoryControllerInterface.h"
+#include "Opcodes.h"
+#include "SystemMode.h"
+
+namespace gbxcore
+{
+
+class ThreadedControlUnit : public ControlUnit
+{
+public:
+    ThreadedControlUnit() = default;
+    virtual ~ThreadedControlUnit() = default;
+    virtual void RunCycle() override;
+    virtual size_t RunBounded(const interfaces::ExecutionBounds&) override;
+
+    virtual void Initialize(interfaces::MemoryControllerInterface*,
+                            interfaces::ArithmeticLogicUnitInterface*) override;
+
+    [[nodiscard]] BasicBlockCache& BlockCache();
+
+    constexpr static size_t MaximumBlockLength = 64;
+    constexpr static size_t MaximumInstructionLength = 4;
+
+protected:
+    inline std::shared_ptr<BasicBlock> AcquireBlock();
+    std::shared_ptr<BasicBlock> TranslateBlock(PrivilegeMode, uint16_t);
+    size_t RunBlock(BasicBlock&, const interfaces::ExecutionBounds& = interfaces::UnboundedExecution);
+    bool ReachedBounds(const interfaces::ExecutionBounds&, size_t);
+    inline void ObserveMemoryController(interfaces::MemoryControllerInterface*);
+    inline static bool IsBlockTerminator(instructions::OpcodeType);
+    inline bool IsPrefetchable(size_t);
+
+    BasicBlockCache _blockCache;
+    interfaces::MemoryControllerInterface* _observedMemoryController{};
+};
+
+}
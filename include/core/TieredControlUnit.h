@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "BasicBlockCache.h"
+#include "ExecutionEngine.h"
+#include "GBXCoreExceptions.h"
+#include "JournalingMemoryController.h"
+#include "RegisterBankInterface.h"
+#include "SystemMode.h"
+#include "ThreadedControlUnit.h"
+
+namespace gbxcore
+{
+
+typedef struct RegisterSnapshot_t
+{
+    gbxcore::SecurityLevel Level;
+    std::array<uint8_t, 10> Registers;
+    std::array<uint16_t, 4> Pairs;
+}
+RegisterSnapshot;
+
+class TieredControlUnit : public ThreadedControlUnit
+{
+public:
+    explicit TieredControlUnit(interfaces::RegisterBankInterface*, ExecutionValidation = ExecutionValidation::None);
+    virtual ~TieredControlUnit() = default;
+    virtual void RunCycle() override;
+    virtual size_t RunBounded(const interfaces::ExecutionBounds&) override;
+
+    virtual void Initialize(interfaces::MemoryControllerInterface*,
+                            interfaces::ArithmeticLogicUnitInterface*) override;
+
+    constexpr static size_t HotBlockThreshold = 0x10;
+    constexpr static size_t SelfModifyingCodeThreshold = 0x04;
+
+protected:
+    inline std::shared_ptr<BasicBlock> AcquireTieredBlock(PrivilegeMode, uint16_t);
+    inline size_t RunInterpretedBlock(BasicBlock&, const interfaces::ExecutionBounds&);
+    inline size_t RunValidatedBlock(BasicBlock&, const interfaces::ExecutionBounds&);
+    inline void ValidateBlock(BasicBlock&, RegisterSnapshot&, uint64_t, std::vector<memory::JournaledWrite>&);
+    inline RegisterSnapshot SaveRegisters();
+    inline void RestoreRegisters(RegisterSnapshot&);
+
+    constexpr static std::array<interfaces::Register, 10> SnapshotRegisters
+    {
+        interfaces::Register::B, interfaces::Register::C, interfaces::Register::D, interfaces::Register::E, interfaces::Register::H, 
+        interfaces::Register::L, interfaces::Register::A, interfaces::Register::F, interfaces::Register::IR, interfaces::Register::PIR
+    };
+
+    constexpr static std::array<interfaces::Register, 4> SnapshotPairs
+    {
+        interfaces::Register::PC, interfaces::Register::SP, interfaces::Register::IX, interfaces::Register::IY
+    };
+
+    interfaces::RegisterBankInterface* _registers;
+    ExecutionValidation _validation;
+    std::unique_ptr<memory::JournalingMemoryController> _journal;
+    std::shared_ptr<BasicBlock> _hotBlock;
+};
+
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+// Tracing is selected at compile time (-DGBX_TRACE_LEVEL=<level>); with the default
+// level every trace point compiles away
+#ifndef GBX_TRACE_LEVEL
+#define GBX_TRACE_LEVEL 0
+#endif
+
+namespace gbxcore
+{
+
+enum class TraceLevel : uint8_t
+{
+    None = 0,
+    Instructions = 1,
+};
+
+constexpr TraceLevel CompiledTraceLevel = static_cast<TraceLevel>(GBX_TRACE_LEVEL);
+
+constexpr bool IsTraceLevelEnabled(TraceLevel level)
+{
+    return static_cast<uint8_t>(CompiledTraceLevel) >= static_cast<uint8_t>(level) && level != TraceLevel::None;
+}
+
+}
@@ -1,39 +1,87 @@
 #pragma once
 
+#include <bitset>
+#include <limits>
 #include <memory>
+#include <string>
 
+#include "ArithmeticLogicUnit.h"
 #include "ArithmeticLogicUnitInterface.h"
 #include "ClockInterface.h"
+#include "ControlUnit.h"
 #include "ControlUnitInterface.h"
+#include "EventScheduler.h"
+#include "MemoryController.h"
 #include "MemoryControllerInterface.h"
+#include "RegisterBank.h"
 #include "RegisterBankInterface.h"
+#include "Runtime.h"
 #include "VideoOutputInterface.h"
 
 namespace gbxcore
 {
 
+// Components are held by their concrete types, so the calls Z80X itself makes on final implementations (the ALU's signal and
+// cycle getters, register access) are direct. Only those are devirtualized: per-instruction work still dispatches through the
+// control unit, and the ALU and instructions reach memory and registers through their interfaces. The default arguments
+// keep the interface-based configuration used with test mocks.
+template<typename ControlUnitT = interfaces::ControlUnitInterface,
+         typename AluT = interfaces::ArithmeticLogicUnitInterface,
+         typename RegistersT = interfaces::RegisterBankInterface,
+         typename MemoryT = interfaces::MemoryControllerInterface>
 class Z80X
 {
 public:
     Z80X() = default;
     ~Z80X() = default;
 
-    void Initialize(std::unique_ptr<interfaces::ControlUnitInterface>, 
+    void Initialize(std::unique_ptr<ControlUnitT>, 
                     std::unique_ptr<interfaces::ClockInterface>,
-                    std::unique_ptr<interfaces::ArithmeticLogicUnitInterface>,
-                    std::unique_ptr<interfaces::MemoryControllerInterface>,
-                    std::unique_ptr<interfaces::RegisterBankInterface>,
+                    std::unique_ptr<AluT>,
+                    std::unique_ptr<MemoryT>,
+                    std::unique_ptr<RegistersT>,
                     std::unique_ptr<interfaces::VideoOutputInterface>);
 
     void Run();
+    interfaces::StopReason RunFor(uint64_t, const interfaces::CancellationCheck&);
+    interfaces::StopReason RunInstructions(uint64_t, const interfaces::CancellationCheck&);
+    void Render();
+    void Stall(uint64_t);
+
+    void SetBreakpoint(uint16_t);
+    void ClearBreakpoint(uint16_t);
+
+    [[nodiscard]] uint64_t Cycles() const;
+    [[nodiscard]] uint64_t Instructions() const;
+    [[nodiscard]] EventScheduler& Scheduler();
+    [[nodiscard]] const std::string& LastError() const;
+
+    constexpr static uint64_t CancellationCheckInterval = 0x400;
 
 protected:
-    std::unique_ptr<interfaces::ControlUnitInterface> _controlUnit;
-    std::unique_ptr<interfaces::RegisterBankInterface> _registers;
+    std::unique_ptr<ControlUnitT> _controlUnit;
+    std::unique_ptr<RegistersT> _registers;
     std::unique_ptr<interfaces::ClockInterface> _clock;
-    std::unique_ptr<interfaces::ArithmeticLogicUnitInterface> _alu;
-    std::unique_ptr<interfaces::MemoryControllerInterface> _memoryController;
+    std::unique_ptr<AluT> _alu;
+    std::unique_ptr<MemoryT> _memoryController;
     std::unique_ptr<interfaces::VideoOutputInterface> _videoOutput;
+
+private:
+    inline interfaces::StopReason RunBatch(uint64_t, uint64_t, const interfaces::CancellationCheck&);
+    inline void SynchronizeClock();
+    inline void RunDueEvents();
+
+    EventScheduler _scheduler;
+    std::bitset<0x10000> _breakpoints;
+    size_t _breakpointCount{};
+    uint64_t _instructions{};
+    std::string _lastError;
 };
 
+// The control unit stays polymorphic so that the execution engine can be selected at runtime
+typedef Z80X<ControlUnit, ArithmeticLogicUnit, RegisterBank, memory::MemoryController> NativeZ80X;
+
+extern template class Z80X<>;
+extern template class Z80X<ControlUnit, ArithmeticLogicUnit, RegisterBank, memory::MemoryController>;
+
 }
\ No newline at end of file
@@ -11,11 +11,17 @@ namespace gbxcore::constants
     const size_t LCDBackgroundScrollXAddress         = 0xFF43llu;
     const size_t LCDScanLineYAddress                 = 0xFF44llu;
     const size_t LCDScanLineYCompareAddress          = 0xFF45llu;
+    const size_t OAMDMARegisterAddress               = 0xFF46llu;
     const size_t LCDWindowScrollYAddress             = 0xFF4Allu;
     const size_t LCDWindowScrollXAddress             = 0xFF4Bllu;
     const size_t DMGBackgroundPaletteAddress         = 0xFF47llu;
     const size_t DMGObjectPalette0Address            = 0xFF48llu;
     const size_t DMGObjectPalette1Address            = 0xFF49llu;
+    const size_t CGBHDMASourceHighAddress            = 0xFF51llu;
+    const size_t CGBHDMASourceLowAddress             = 0xFF52llu;
+    const size_t CGBHDMADestinationHighAddress       = 0xFF53llu;
+    const size_t CGBHDMADestinationLowAddress        = 0xFF54llu;
+    const size_t CGBHDMAControlAddress               = 0xFF55llu;
     const size_t CGBBackgroundPaletteIndexRegister   = 0xFF68llu;
     const size_t CGBBackgroundPaletteDataRegister    = 0xFF69llu;
     const size_t CGBObjectPaletteIndexRegister       = 0xFF6Allu;
@@ -20,8 +20,8 @@ constexpr size_t GBXSystemRAMFinalAddress = GBXSystemRAMInitialAddress + GBXSyst
 const size_t DMGBCROMBankSize = 0x4000;
 const size_t FixedBankROMSize = 0x8000; // System Bootup code (255 bytes used of a 16KB ROM Bank) + Cartridge Fixed Bank 16KB
 
-// Temporary (the dynamic Bank ROM size must change depending on the rom MBC. Also, gbx will have other configuration)
-const size_t DMGBCMaxDynamicROMSize = 0x1FC000; // Max Dynamic Bank ROM Size 2MB - 16KB
+// The switchable ROM bank spans the whole cartridge ROM, so that bank numbers match the ones written to the MBC
+const size_t DMGBCMaxROMSize = 0x200000; // Max Cartridge ROM Size 2MB
 
 const size_t DMGBCFixedROMInitialAddress = 0x0000;
 const size_t UserFixedROMPhysicalSize = 0x4000;
@@ -34,10 +34,13 @@ constexpr size_t DMGBCBankedROMFinalAddress = DMGBCBankedROMInitialAddress + Use
 const size_t DMGBCVideoRAMInitialAddress = 0x8000;
 const size_t DMGBCVideoRAMPhysicalSize = 0x2000;
 constexpr size_t DMGBCVideoRAMFinalAddress = DMGBCVideoRAMInitialAddress + DMGBCVideoRAMPhysicalSize;
+const size_t CGBVideoRAMDMABlockSize = 0x10;
+const uint64_t CGBVideoRAMDMABlockCycles = 8; // Machine cycles the CPU is halted for per block (single speed)
 
 const size_t DMGBCExternalRAMInitialAddress = 0xA000;
 const size_t DMGBCExternalRAMPhysicalSize = 0x2000;
 constexpr size_t DMGBCExternalRAMFinalAddress = DMGBCExternalRAMInitialAddress + DMGBCExternalRAMPhysicalSize;
+const size_t DMGBCMaxExternalRAMSize = 0x20000; // Max Cartridge RAM Size 128KB (16 banks of 8KB)
 
 const size_t DMGBCSystemRAMBank0InitialAddress = 0xC000;
 const size_t DMGBCSystemRAMBank0PhysicalSize = 0x1000;
@@ -51,6 +54,12 @@ const size_t DMGBCMirrorRAMInitialAddress = 0xE000;
 const size_t DMGBCMirrorRAMPhysicalSize = 0x1E00;
 constexpr size_t DMGBCMirrorRAMFinalAddress = DMGBCMirrorRAMInitialAddress + DMGBCMirrorRAMPhysicalSize;
 
+const size_t DMGBCOAMInitialAddress = 0xFE00;
+const size_t DMGBCOAMPhysicalSize = 0x100; // 160 bytes of OAM + the unusable area, so the page can be mapped directly
+constexpr size_t DMGBCOAMFinalAddress = DMGBCOAMInitialAddress + DMGBCOAMPhysicalSize;
+const size_t DMGBCOAMDMATransferSize = 0xA0;
+const uint64_t DMGBCOAMDMATransferCycles = 160; // One machine cycle per byte, during which only HRAM can be accessed
+
 const size_t DMGBCIORAMInitialAddress = 0xFF00;
 const size_t DMGBCIORAMPhysicalSize = 0x80;
 constexpr size_t DMGBCIORAMFinalAddress = DMGBCIORAMInitialAddress + DMGBCIORAMPhysicalSize;
@@ -61,6 +70,11 @@ constexpr size_t DMGBCHRAMFinalAddress = DMGBCHRAMInitialAddress + DMGBCHRAMPhys
 
 // Clock Constants
 static const uint64_t GBCClockPeriod = 119;
+constexpr uint64_t DMGBCMachineCyclesPerScanLine = 114;
+constexpr uint64_t DMGBCScanLinesPerFrame = 154;
+constexpr uint64_t DMGBCMachineCyclesPerFrame = DMGBCMachineCyclesPerScanLine * DMGBCScanLinesPerFrame;
+constexpr uint64_t DMGBCVisibleScanLines = 144;
+constexpr uint64_t DMGBCMachineCyclesToHBlank = 63; // OAM search (20) + pixel transfer (43)
 
 // Video Constants
 const float DefaultViewPortScaleX = 3.0f;
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "InstructionInterface.h"
+
+namespace gbxcore::instructions
+{
+
+class InstructionIllegal : public interfaces::InstructionInterface
+{
+public:
+    InstructionIllegal() = default;
+    virtual ~InstructionIllegal() = default;
+    
+    virtual void Decode(uint8_t, std::optional<uint8_t>, interfaces::DecodedInstruction&) override;
+    virtual void Execute(interfaces::RegisterBankInterface*, interfaces::DecodedInstruction&) override;
+};
+
+}
\ No newline at end of file
@@ -5,14 +5,14 @@
 namespace gbxcore::instructions
 {
 
-class InstructionJp : public interfaces::InstructionInterface
+class InstructionJp : public interfaces::ConditionalInstructionInterface
 {
 public:
     InstructionJp() = default;
     virtual ~InstructionJp() = default;
     
     virtual void Decode(uint8_t, std::optional<uint8_t>, interfaces::DecodedInstruction&) override;
-    virtual void Execute(interfaces::RegisterBankInterface*, interfaces::DecodedInstruction&) override;
+    virtual bool ConditionallyExecute(interfaces::RegisterBankInterface*, interfaces::DecodedInstruction&) override;
 
 private:
     inline void DecodeUnconditionalJpRegisterIndirect(interfaces::DecodedInstruction&);
@@ -20,7 +20,7 @@ private:
     inline void DecodeConditionalJp(uint8_t, interfaces::DecodedInstruction&);
     inline void ExecuteUnconditionalJp(interfaces::RegisterBankInterface*, interfaces::DecodedInstruction&);
     inline void ExecuteUnconditionalJpRegisterIndirect(interfaces::RegisterBankInterface*, interfaces::DecodedInstruction&);
-    inline void ExecuteConditionalJp(interfaces::RegisterBankInterface*, interfaces::DecodedInstruction&);
+    inline bool ExecuteConditionalJp(interfaces::RegisterBankInterface*, interfaces::DecodedInstruction&);
 };
 
 }
\ No newline at end of file
@@ -5,20 +5,20 @@
 namespace gbxcore::instructions
 {
 
-class InstructionJr : public interfaces::InstructionInterface
+class InstructionJr : public interfaces::ConditionalInstructionInterface
 {
 public:
     InstructionJr() = default;
     virtual ~InstructionJr() = default;
     
     virtual void Decode(uint8_t, std::optional<uint8_t>, interfaces::DecodedInstruction&) override;
-    virtual void Execute(interfaces::RegisterBankInterface*, interfaces::DecodedInstruction&) override;
+    virtual bool ConditionallyExecute(interfaces::RegisterBankInterface*, interfaces::DecodedInstruction&) override;
 
 private:
     inline void DecodeUnconditionalJr(interfaces::DecodedInstruction&);
     inline void DecodeConditionalJr(uint8_t, interfaces::DecodedInstruction&);
     inline void ExecuteUnconditionalJr(interfaces::RegisterBankInterface*, interfaces::DecodedInstruction&);
-    inline void ExecuteConditionalJr(interfaces::RegisterBankInterface*, interfaces::DecodedInstruction&);
+    inline bool ExecuteConditionalJr(interfaces::RegisterBankInterface*, interfaces::DecodedInstruction&);
 };
 
 }
\ No newline at end of file
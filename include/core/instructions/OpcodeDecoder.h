@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <memory>
 #include <optional>
 
@@ -17,6 +18,7 @@
 #include "InstructionEi.h"
 #include "InstructionInc.h"
 #include "InstructionHalt.h"
+#include "InstructionIllegal.h"
 #include "InstructionJp.h"
 #include "InstructionJr.h"
 #include "InstructionLdAndLdu.h"
@@ -53,7 +55,7 @@
 #include "GBXCoreExceptions.h"
 #include "InstructionInterface.h"
 #include "InstructionUtilities.h"
-#include "OpcodePatternMatcher.h"
+#include "OpcodeDispatchTable.h"
 
 namespace gbxcore::instructions
 {
@@ -61,15 +63,26 @@ namespace gbxcore::instructions
 class OpcodeDecoder
 {
 public:
-    OpcodeDecoder() = default;
+    OpcodeDecoder();
     ~OpcodeDecoder() = default;
 
+    OpcodeDecoder(const OpcodeDecoder&) = delete;
+    OpcodeDecoder& operator=(const OpcodeDecoder&) = delete;
+
     [[nodiscard]] interfaces::BaseInstructionInterface* DecodeOpcode(uint8_t, std::optional<uint8_t>);
 
 private:
-    interfaces::BaseInstructionInterface* DecodeInstructionWithPreOpcode(uint8_t, std::optional<uint8_t>);
-    interfaces::BaseInstructionInterface* DecodeInstructionWithoutPreOpcode(uint8_t);
+    typedef std::array<interfaces::BaseInstructionInterface*, 0x100> InstructionTable;
+
+    inline void ResolveTable(const OpcodeDispatchTable&, InstructionTable&);
+    inline interfaces::BaseInstructionInterface* ResolveSlot(InstructionSlot);
+
+    InstructionTable _unprefixedTable{};
+    InstructionTable _prefixCBTable{};
+    InstructionTable _prefixIndexedTable{};
+    InstructionTable _prefixFCTable{};
 
+    InstructionIllegal _instructionIllegal;
     InstructionBit _instructionBit;
     InstructionRes _instructionRes;
     InstructionSet _instructionSet;
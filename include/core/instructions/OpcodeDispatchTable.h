@@ -0,0 +1,359 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "OpcodePatternMatcher.h"
+
+namespace gbxcore::instructions
+{
+
+enum class InstructionSlot : uint8_t
+{
+    Illegal,
+    Adc,
+    Add,
+    And,
+    Bit,
+    Call,
+    Ccf,
+    Cp,
+    Cpl,
+    Daa,
+    Dec,
+    Di,
+    Ei,
+    Halt,
+    Inc,
+    Jp,
+    Jpu,
+    Jr,
+    LdAndLdu,
+    Ldhl,
+    Nop,
+    Or,
+    Pop,
+    Push,
+    Res,
+    Ret,
+    Reti,
+    Rl,
+    Rla,
+    Rlc,
+    Rlca,
+    Rr,
+    Rra,
+    Rrc,
+    Rrca,
+    Rst,
+    Sbc,
+    Scf,
+    Set,
+    Sla,
+    Sra,
+    Srl,
+    Stop,
+    Sub,
+    Swap,
+    Xor,
+};
+
+typedef std::array<InstructionSlot, 0x100> OpcodeDispatchTable;
+
+class OpcodeDispatchTableBuilder
+{
+public:
+    constexpr static OpcodeDispatchTable Build(InstructionSlot (*classify)(uint8_t))
+    {
+        OpcodeDispatchTable table{};
+
+        for (auto opcode = 0x00; opcode <= 0xFF; ++opcode)
+            table[opcode] = classify(static_cast<uint8_t>(opcode));
+
+        return table;
+    }
+
+    constexpr static InstructionSlot ClassifyUnprefixed(uint8_t opcode)
+    {
+        if (OpcodePatternMatcher::Match(opcode, // 0000 0000
+            OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '0'_b, '0'_b, '0'_b, '0'_b, '0'_b)))
+            return InstructionSlot::Nop;
+        else if (OpcodePatternMatcher::Match(opcode, // 0001 0000
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '1'_b, '0'_b, '0'_b, '0'_b, '0'_b)))
+                 return InstructionSlot::Stop;
+        else if (OpcodePatternMatcher::Match(opcode, // 0000 0111
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '0'_b, '0'_b, '1'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Rlca;
+        else if (OpcodePatternMatcher::Match(opcode, // 0001 0111
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '1'_b, '0'_b, '1'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Rla;
+        else if (OpcodePatternMatcher::Match(opcode, // 0010 0111
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, '0'_b, '0'_b, '1'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Daa;
+        else if (OpcodePatternMatcher::Match(opcode, // 0010 1111
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, '0'_b, '1'_b, '1'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Cpl;
+        else if (OpcodePatternMatcher::Match(opcode, // 0011 1111
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, '1'_b, '1'_b, '1'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Ccf;
+        else if (OpcodePatternMatcher::Match(opcode, // 0011 0111
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, '1'_b, '0'_b, '1'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Scf;
+        else if (OpcodePatternMatcher::Match(opcode, // 0001 1000
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '1'_b, '1'_b, '0'_b, '0'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 001X X000
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, 'X'_b, 'X'_b, '0'_b, '0'_b, '0'_b)))
+                 return InstructionSlot::Jr;
+        else if (OpcodePatternMatcher::Match(opcode, // 0111 0110
+                 OpcodePatternMatcher::Pattern('0'_b, '1'_b, '1'_b, '1'_b, '0'_b, '1'_b, '1'_b, '0'_b)))
+                 return InstructionSlot::Halt;
+        else if (OpcodePatternMatcher::Match(opcode, // 1110 1001
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, '0'_b, '1'_b, '0'_b, '0'_b, '1'_b)) || 
+                 OpcodePatternMatcher::Match(opcode, // 110X X01X
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '0'_b, 'X'_b, 'X'_b, '0'_b, '1'_b, 'X'_b)))
+                 return InstructionSlot::Jp;
+        else if (OpcodePatternMatcher::Match(opcode, // 0000 1111
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '0'_b, '1'_b, '1'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Rrca;
+        else if (OpcodePatternMatcher::Match(opcode, // 0001 1111
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '1'_b, '1'_b, '1'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Rra;
+        else if (OpcodePatternMatcher::Match(opcode, // 00XX 1001
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, 'X'_b, 'X'_b, '1'_b, '0'_b, '0'_b, '1'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1000 0110
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '0'_b, '0'_b, '0'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1000 0XXX
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '0'_b, '0'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1100 0110
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '0'_b, '0'_b, '0'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1110 1000
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, '0'_b, '1'_b, '0'_b, '0'_b, '0'_b)))
+                 return InstructionSlot::Add;
+        else if (OpcodePatternMatcher::Match(opcode, // 110X X000
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '0'_b, 'X'_b, 'X'_b, '0'_b, '0'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1100 1001
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '0'_b, '0'_b, '1'_b, '0'_b, '0'_b, '1'_b)))
+                 return InstructionSlot::Ret;
+        else if (OpcodePatternMatcher::Match(opcode, // 1101 1001
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '0'_b, '1'_b, '1'_b, '0'_b, '0'_b, '1'_b)))
+                 return InstructionSlot::Reti;
+        else if (OpcodePatternMatcher::Match(opcode, // 11XX X111
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b, '1'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Rst;
+        else if (OpcodePatternMatcher::Match(opcode, // 1100 1101
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '0'_b, '0'_b, '1'_b, '1'_b, '0'_b, '1'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 110X X100
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '0'_b, 'X'_b, 'X'_b, '1'_b, '0'_b, '0'_b)))
+                 return InstructionSlot::Call; 
+        else if (OpcodePatternMatcher::Match(opcode, // 1100 1110
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '0'_b, '0'_b, '1'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1000 1110
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '0'_b, '0'_b, '1'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1000 1XXX
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '0'_b, '0'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b)))
+                 return InstructionSlot::Adc;
+        else if (OpcodePatternMatcher::Match(opcode, // 1001 0XXX
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '0'_b, '1'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1001 0110
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '0'_b, '1'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1101 0110
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '0'_b, '1'_b, '0'_b, '1'_b, '1'_b, '0'_b)))
+                 return InstructionSlot::Sub;
+        else if (OpcodePatternMatcher::Match(opcode, // 1101 1110
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '0'_b, '1'_b, '1'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1001 1110
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '0'_b, '1'_b, '1'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1001 1XXX
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '0'_b, '1'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b)))
+                 return InstructionSlot::Sbc;
+        else if (OpcodePatternMatcher::Match(opcode, // 1110 0110
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, '0'_b, '0'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1010 0110
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '1'_b, '0'_b, '0'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1010 0XXX
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '1'_b, '0'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b)))
+                 return InstructionSlot::And;
+        else if (OpcodePatternMatcher::Match(opcode, // 1111 0110
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, '1'_b, '0'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1011 0110
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '1'_b, '1'_b, '0'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1011 0XXX
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '1'_b, '1'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b)))
+                 return InstructionSlot::Or;
+        else if (OpcodePatternMatcher::Match(opcode, // 1110 1110
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, '0'_b, '1'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1010 1110
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '1'_b, '0'_b, '1'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1010 1XXX
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '1'_b, '0'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b)))
+                 return InstructionSlot::Xor;
+        else if (OpcodePatternMatcher::Match(opcode, // 1111 1000
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, '1'_b, '1'_b, '0'_b, '0'_b, '0'_b)))
+                 return InstructionSlot::Ldhl;
+        else if (OpcodePatternMatcher::Match(opcode, // 1111 1011
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, '1'_b, '1'_b, '0'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Ei;
+        else if (OpcodePatternMatcher::Match(opcode, // 1111 0011
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, '1'_b, '0'_b, '0'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Di;
+        else if (OpcodePatternMatcher::Match(opcode, // 1111 1110
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, '1'_b, '1'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1011 1110
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '1'_b, '1'_b, '1'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1011 1XXX
+                 OpcodePatternMatcher::Pattern('1'_b, '0'_b, '1'_b, '1'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b)))
+                 return InstructionSlot::Cp;
+        else if (OpcodePatternMatcher::Match(opcode, // 0011 0100
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, '1'_b, '0'_b, '1'_b, '0'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 00XX X100
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b, '1'_b, '0'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 00XX 0011
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, 'X'_b, 'X'_b, '0'_b, '0'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Inc;
+        else if (OpcodePatternMatcher::Match(opcode, // 0011 0101
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, '1'_b, '0'_b, '1'_b, '0'_b, '1'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 00XX X101
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b, '1'_b, '0'_b, '1'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 00XX 1011
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, 'X'_b, 'X'_b, '1'_b, '0'_b, '1'_b, '1'_b)))
+                 return InstructionSlot::Dec;
+        else if (OpcodePatternMatcher::Match(opcode, // 11XX 0101
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, 'X'_b, 'X'_b, '0'_b, '1'_b, '0'_b, '1'_b)))
+                 return InstructionSlot::Push;
+        else if (OpcodePatternMatcher::Match(opcode, // 11XX 0001
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, 'X'_b, 'X'_b, '0'_b, '0'_b, '0'_b, '1'_b)))
+                 return InstructionSlot::Pop;
+        else if (OpcodePatternMatcher::Match(opcode, // 0000 1000
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '0'_b, '1'_b, '0'_b, '0'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 00XX 0001
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, 'X'_b, 'X'_b, '0'_b, '0'_b, '0'_b, '1'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 0011 0110
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, '1'_b, '0'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 001X 1010
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, 'X'_b, '1'_b, '0'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 001X 0010
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, 'X'_b, '0'_b, '0'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 00XX X110
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 000X 1010
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, 'X'_b, '1'_b, '0'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 000X 0010
+                 OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, 'X'_b, '0'_b, '0'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 0111 0XXX
+                 OpcodePatternMatcher::Pattern('0'_b, '1'_b, '1'_b, '1'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 111X 0010
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, 'X'_b, '0'_b, '0'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 111X 0000
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, 'X'_b, '0'_b, '0'_b, '0'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 111X 1010
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, 'X'_b, '1'_b, '0'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 1111 1001
+                 OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, '1'_b, '1'_b, '0'_b, '0'_b, '1'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 01XX X110
+                 OpcodePatternMatcher::Pattern('0'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b, '1'_b, '1'_b, '0'_b)) ||
+                 OpcodePatternMatcher::Match(opcode, // 01XX XXXX
+                 OpcodePatternMatcher::Pattern('0'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b)))
+                 return InstructionSlot::LdAndLdu;
+
+        return InstructionSlot::Illegal;
+    }
+
+    constexpr static InstructionSlot ClassifyPrefixCB(uint8_t opcode)
+    {
+        if (OpcodePatternMatcher::Match(opcode, // 01XX XXXX
+            OpcodePatternMatcher::Pattern('0'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b)))
+            return InstructionSlot::Bit;
+        else if (OpcodePatternMatcher::Match(opcode, // 10XX XXXX
+                OpcodePatternMatcher::Pattern('1'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b)))
+                return InstructionSlot::Res;
+        else if (OpcodePatternMatcher::Match(opcode, // 11XX XXXX
+                OpcodePatternMatcher::Pattern('1'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b)))
+                return InstructionSlot::Set;
+        else if (OpcodePatternMatcher::Match(opcode, // 0000 0XXX
+                OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '0'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b)))
+                return InstructionSlot::Rlc;
+        else if (OpcodePatternMatcher::Match(opcode, // 0001 0XXX
+                OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '1'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b)))
+                return InstructionSlot::Rl;
+        else if (OpcodePatternMatcher::Match(opcode, // 0000 1XXX
+                OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '0'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b)))
+                return InstructionSlot::Rrc;
+        else if (OpcodePatternMatcher::Match(opcode, // 0001 1XXX
+                OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '1'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b)))
+                return InstructionSlot::Rr;
+        else if (OpcodePatternMatcher::Match(opcode, // 0010 0XXX
+                OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, '0'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b)))
+                return InstructionSlot::Sla;
+        else if (OpcodePatternMatcher::Match(opcode, // 0010 1XXX
+                OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, '0'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b)))
+                return InstructionSlot::Sra;
+        else if (OpcodePatternMatcher::Match(opcode, // 0011 1XXX
+                OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, '1'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b)))
+                return InstructionSlot::Srl;
+        else if (OpcodePatternMatcher::Match(opcode, // 0011 0XXX
+                OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, '1'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b)))
+                return InstructionSlot::Swap;
+
+        return InstructionSlot::Illegal;
+    }
+
+    // DD and FD share the same (indexed) opcode space
+    constexpr static InstructionSlot ClassifyPrefixIndexed(uint8_t opcode)
+    {
+        if (OpcodePatternMatcher::Match(opcode, // 01XX X110
+            OpcodePatternMatcher::Pattern('0'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b, '1'_b, '1'_b, '0'_b)) ||
+            OpcodePatternMatcher::Match(opcode, // 0111 0XXX
+            OpcodePatternMatcher::Pattern('0'_b, '1'_b, '1'_b, '1'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b)))
+            return InstructionSlot::LdAndLdu;
+
+        return InstructionSlot::Illegal;
+    }
+
+    // [GBX ONLY] System-SecurityLevel Instruction
+    constexpr static InstructionSlot ClassifyPrefixFC(uint8_t opcode)
+    {
+        if (OpcodePatternMatcher::Match(opcode, // 1100 0011
+            OpcodePatternMatcher::Pattern('1'_b, '1'_b, '0'_b, '0'_b, '0'_b, '0'_b, '1'_b, '1'_b)))
+            return InstructionSlot::Jpu;
+        else if (OpcodePatternMatcher::Match(opcode, // 0000 1000
+             OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, '0'_b, '1'_b, '0'_b, '0'_b, '0'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 00XX 0001
+             OpcodePatternMatcher::Pattern('0'_b, '0'_b, 'X'_b, 'X'_b, '0'_b, '0'_b, '0'_b, '1'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 0011 0110
+             OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, '1'_b, '0'_b, '1'_b, '1'_b, '0'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 001X 1010
+             OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, 'X'_b, '1'_b, '0'_b, '1'_b, '0'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 001X 0010
+             OpcodePatternMatcher::Pattern('0'_b, '0'_b, '1'_b, 'X'_b, '0'_b, '0'_b, '1'_b, '0'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 00XX X110
+             OpcodePatternMatcher::Pattern('0'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b, '1'_b, '1'_b, '0'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 000X 1010
+             OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, 'X'_b, '1'_b, '0'_b, '1'_b, '0'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 000X 0010
+             OpcodePatternMatcher::Pattern('0'_b, '0'_b, '0'_b, 'X'_b, '0'_b, '0'_b, '1'_b, '0'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 0111 0XXX
+             OpcodePatternMatcher::Pattern('0'_b, '1'_b, '1'_b, '1'_b, '0'_b, 'X'_b, 'X'_b, 'X'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 111X 0010
+             OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, 'X'_b, '0'_b, '0'_b, '1'_b, '0'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 111X 0000
+             OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, 'X'_b, '0'_b, '0'_b, '0'_b, '0'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 111X 1010
+             OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, 'X'_b, '1'_b, '0'_b, '1'_b, '0'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 1111 1001
+             OpcodePatternMatcher::Pattern('1'_b, '1'_b, '1'_b, '1'_b, '1'_b, '0'_b, '0'_b, '1'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 01XX X110
+             OpcodePatternMatcher::Pattern('0'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b, '1'_b, '1'_b, '0'_b)) ||
+             OpcodePatternMatcher::Match(opcode, // 01XX XXXX
+             OpcodePatternMatcher::Pattern('0'_b, '1'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b, 'X'_b)))
+             return InstructionSlot::LdAndLdu;
+
+        return InstructionSlot::Illegal;
+    }
+};
+
+inline constexpr OpcodeDispatchTable UnprefixedDispatchTable = OpcodeDispatchTableBuilder::Build(OpcodeDispatchTableBuilder::ClassifyUnprefixed);
+inline constexpr OpcodeDispatchTable PrefixCBDispatchTable = OpcodeDispatchTableBuilder::Build(OpcodeDispatchTableBuilder::ClassifyPrefixCB);
+inline constexpr OpcodeDispatchTable PrefixIndexedDispatchTable = OpcodeDispatchTableBuilder::Build(OpcodeDispatchTableBuilder::ClassifyPrefixIndexed);
+inline constexpr OpcodeDispatchTable PrefixFCDispatchTable = OpcodeDispatchTableBuilder::Build(OpcodeDispatchTableBuilder::ClassifyPrefixFC);
+
+}
\ No newline at end of file
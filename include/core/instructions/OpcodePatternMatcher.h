@@ -34,7 +34,7 @@ OpcodePattern;
 class OpcodePatternMatcher
 {
 public:
-    inline static bool Match(uint8_t opcode, OpcodePattern opcodePattern)
+    constexpr static bool Match(uint8_t opcode, OpcodePattern opcodePattern)
     {
         return ((opcode & opcodePattern.mask) ^ opcodePattern.pattern) == 0;
     }
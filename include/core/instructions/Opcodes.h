@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace gbxcore::instructions
 {
 
@@ -55,8 +58,13 @@ enum class OpcodeType
     // System SecurityLevel Operations
     jpu,
     ldu,
+
+    // Undefined opcodes (CPU trap)
+    illegal,
 };
 
+constexpr size_t OpcodeTypeCount = static_cast<size_t>(OpcodeType::illegal) + 1;
+
 const uint8_t MemoryOperand = 0x06;
 
 }
\ No newline at end of file
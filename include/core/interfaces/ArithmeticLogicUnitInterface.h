@@ -29,6 +29,19 @@ struct DecodedInstruction
     uint8_t InstructionExtraOperand;
 };
 
+class BaseInstructionInterface;
+
+typedef struct PredecodedInstruction_t
+{
+    uint8_t PreOpcode;
+    uint8_t Opcode;
+    uint8_t Length;
+    BaseInstructionInterface* Instruction;
+    DecodedInstruction Template;
+    const AddressingModeFormat* AddressingModeTraits;
+}
+PredecodedInstruction;
+
 class InstructionConstants
 {
 public:
@@ -54,16 +67,25 @@ public:
     virtual void Execute() = 0;
     
     virtual void AcquireInstruction(interfaces::MemoryControllerInterface* memoryController) = 0;
+    [[nodiscard]] virtual PredecodedInstruction PredecodeInstruction(interfaces::MemoryControllerInterface*, uint16_t) = 0;
+    virtual void LoadPredecodedInstruction(const PredecodedInstruction&) = 0;
 
     [[nodiscard]] virtual bool ClearInterruptStatusSignal() = 0;
     [[nodiscard]] virtual bool HaltSignal() = 0;
     [[nodiscard]] virtual bool StopSignal() = 0;
+    [[nodiscard]] virtual bool IllegalInstructionSignal() = 0;
     [[nodiscard]] virtual bool InterruptMasterEnable() = 0;
     [[nodiscard]] virtual bool IsExecutionAborted() = 0;
     [[nodiscard]] virtual bool UserModeRequested() = 0; 
     [[nodiscard]] virtual bool UserModeSourceOperandRequested() = 0;
+    [[nodiscard]] virtual uint64_t Cycles() = 0;
+    virtual void Stall(uint64_t) = 0;
+    virtual void RestoreCycles(uint64_t) = 0;
+    virtual void SuppressTracing(bool) = 0;
 
-    virtual AddressingModeFormat* AcquireAddressingModeTraits() = 0;
+    virtual const AddressingModeFormat* AcquireAddressingModeTraits() = 0;
+    virtual AddressingMode AcquireAddressingMode() = 0;
+    virtual uint16_t AcquireProgramCounter() = 0;
     virtual void AcquireOperand1AtPC(interfaces::MemoryControllerInterface*) = 0;
     virtual void AcquireOperand1Implicitly(interfaces::MemoryControllerInterface*) = 0;
     virtual void AcquireOperand1AtRegister(interfaces::MemoryControllerInterface*) = 0;
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+namespace gbxcore::interfaces
+{
+
+class BankedMemoryResource
+{
+public:
+    virtual ~BankedMemoryResource() = default;
+    virtual size_t BankCount() = 0;
+    virtual size_t CurrentBank() = 0;
+    virtual void SelectBank(size_t) = 0;
+};
+
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace gbxcore::interfaces
+{
+
+typedef std::function<uint64_t()> CycleSource;
+typedef std::function<void(uint64_t)> CycleStall;
+
+// Peripheral that can take the memory bus away from the CPU (e.g. DMA) for a window of the cycle timeline
+class BusMaster
+{
+public:
+    virtual ~BusMaster() = default;
+    virtual bool HoldsBus() = 0;
+};
+
+}
@@ -10,6 +10,7 @@ class ClockInterface
 public:
     virtual ~ClockInterface() = default;
     virtual uint64_t Ticks() const = 0;
+    virtual void Advance(uint64_t) = 0;
 };
 
 }
\ No newline at end of file
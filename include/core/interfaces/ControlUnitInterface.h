@@ -1,19 +1,42 @@
 #pragma once
 
+#include <bitset>
+#include <cstdint>
+#include <limits>
 #include <memory>
 
 #include "ArithmeticLogicUnitInterface.h"
 #include "MemoryControllerInterface.h"
 
+namespace gbxcore
+{
+class EventScheduler;
+}
+
 namespace gbxcore::interfaces
 {
 
+// Where a bounded run must hand control back to the CPU: after a number of instructions, once the ALU reaches a cycle
+// (or the next scheduled event) or before an instruction at a breakpoint. Null schedulers and breakpoints are not checked.
+typedef struct ExecutionBounds_t
+{
+    size_t Instructions;
+    uint64_t Cycle;
+    const EventScheduler* Scheduler;
+    const std::bitset<0x10000>* Breakpoints;
+}
+ExecutionBounds;
+
+constexpr ExecutionBounds UnboundedExecution{std::numeric_limits<size_t>::max(), std::numeric_limits<uint64_t>::max(), nullptr, nullptr};
+
 class ControlUnitInterface
 {
 public:
     virtual ~ControlUnitInterface() = default;
     virtual void RunCycle() = 0;
+    // Runs at least one instruction and returns how many were executed
+    virtual size_t RunBounded(const ExecutionBounds&) = 0;
     virtual void Initialize(MemoryControllerInterface*, ArithmeticLogicUnitInterface*) = 0;
 };
 
-}
\ No newline at end of file
+}
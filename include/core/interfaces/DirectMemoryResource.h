@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace gbxcore::interfaces
+{
+
+class DirectMemoryResource
+{
+public:
+    virtual ~DirectMemoryResource() = default;
+    virtual uint8_t* Data() = 0;
+    virtual bool IsWritable() = 0;
+};
+
+}
@@ -10,11 +10,18 @@
 namespace gbxcore::interfaces
 {
 
+enum class ExecutionOutcome
+{
+    Completed,
+    Aborted
+};
+
 class BaseInstructionInterface
 {
 public:
     virtual ~BaseInstructionInterface() = default;
     virtual void Decode(uint8_t, std::optional<uint8_t>, interfaces::DecodedInstruction&) = 0;
+    virtual ExecutionOutcome Run(RegisterBankInterface*, DecodedInstruction&) = 0;
 };
 
 class InstructionInterface : public BaseInstructionInterface
@@ -22,6 +29,12 @@ class InstructionInterface : public BaseInstructionInterface
 public:
     virtual ~InstructionInterface() = default;
     virtual void Execute(RegisterBankInterface*, DecodedInstruction&) = 0;
+
+    ExecutionOutcome Run(RegisterBankInterface* registerBank, DecodedInstruction& decodedInstruction) final
+    {
+        Execute(registerBank, decodedInstruction);
+        return ExecutionOutcome::Completed;
+    }
 };
 
 class ConditionalInstructionInterface : public BaseInstructionInterface
@@ -29,6 +42,11 @@ class ConditionalInstructionInterface : public BaseInstructionInterface
 public:
     virtual ~ConditionalInstructionInterface() = default;
     virtual bool ConditionallyExecute(RegisterBankInterface*, DecodedInstruction&) = 0;
+
+    ExecutionOutcome Run(RegisterBankInterface* registerBank, DecodedInstruction& decodedInstruction) final
+    {
+        return ConditionallyExecute(registerBank, decodedInstruction)? ExecutionOutcome::Aborted : ExecutionOutcome::Completed;
+    }
 };
 
 }
\ No newline at end of file
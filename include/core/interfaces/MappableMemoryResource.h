@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace gbxcore::interfaces
+{
+
+// Resources that can be backed by externally owned, read-only memory (e.g. a memory-mapped file) instead of a
+// copy of it. The shared pointer keeps the backing memory alive for as long as the resource uses it.
+class MappableMemoryResource
+{
+public:
+    virtual ~MappableMemoryResource() = default;
+    virtual void Map(std::shared_ptr<const uint8_t>, size_t) = 0;
+};
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+#include "AddressRange.h"
+
+namespace gbxcore::interfaces
+{
+
+// Cartridge memory bank controller. Guest writes to its control range are routed to Write, which switches the
+// banks of the resources it controls; the memory controller then remaps the affected pages.
+class MemoryBankController
+{
+public:
+    virtual ~MemoryBankController() = default;
+    virtual AddressRange ControlRange() = 0;
+    virtual void Write(uint16_t, uint8_t) = 0;
+    virtual size_t ROMBank() = 0;
+    virtual size_t RAMBank() = 0;
+    virtual bool IsRAMEnabled() = 0;
+};
+
+}
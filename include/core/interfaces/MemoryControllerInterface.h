@@ -1,10 +1,14 @@
 #pragma once
 
+#include <memory>
 #include <optional>
+#include <span>
 #include <variant>
+#include <vector>
 
 #include "AddressRange.h"
 #include "MemoryMappedRegister.h"
+#include "MemoryObserver.h"
 #include "MemoryResource.h"
 #include "SystemMode.h"
 
@@ -25,7 +29,54 @@ public:
    
     virtual std::variant<uint8_t, uint16_t> Read(size_t, interfaces::MemoryAccessType) = 0;
     virtual void Write(std::variant<uint8_t, uint16_t>, size_t) = 0;
+
+    // Typed accessors. The defaults adapt the variant API, so controllers that only implement it (e.g. test mocks) keep working
+    virtual uint8_t ReadByte(size_t address) { return std::get<uint8_t>(Read(address, MemoryAccessType::Byte)); }
+    virtual uint16_t ReadWord(size_t address) { return std::get<uint16_t>(Read(address, MemoryAccessType::Word)); }
+    virtual void WriteByte(uint8_t value, size_t address) { Write(value, address); }
+    virtual void WriteWord(uint16_t value, size_t address) { Write(value, address); }
+
+    // Reads through the address space of the given privilege level, leaving the current security level untouched
+    virtual uint8_t ReadByteAs(PrivilegeMode mode, size_t address)
+    {
+        auto oldMode = SecurityLevel();
+        SetSecurityLevel(mode);
+        auto value = ReadByte(address);
+        SetSecurityLevel(oldMode);
+        return value;
+    }
+
+    // Block transfers. The defaults go byte by byte; CopyBlock behaves as if the whole source were read before writing
+    virtual void ReadBlock(size_t address, std::span<uint8_t> destination)
+    {
+        for (auto offset = 0llu; offset < destination.size(); ++offset)
+            destination[offset] = ReadByte(address + offset);
+    }
+
+    virtual void WriteBlock(std::span<const uint8_t> source, size_t address)
+    {
+        for (auto offset = 0llu; offset < source.size(); ++offset)
+            WriteByte(source[offset], address + offset);
+    }
+
+    virtual void CopyBlock(size_t source, size_t destination, size_t size)
+    {
+        std::vector<uint8_t> buffer(size);
+        ReadBlock(source, buffer);
+        WriteBlock(buffer, destination);
+    }
+
+    // Whether a write to the address does more than store a value (memory-mapped registers, bank control, a locked bus)
+    virtual bool HasSideEffects(size_t) { return false; }
+
+    // Whether a read from the address can be issued ahead of execution: plain memory that neither reacts to reads nor faults
+    virtual bool IsPrefetchable(size_t) { return true; }
+
+    // Stores a value without register dispatch, bank control or write notifications. The default can only write.
+    virtual void PokeByte(uint8_t value, size_t address) { WriteByte(value, address); }
+
     virtual void Load(std::unique_ptr<uint8_t*>, size_t, size_t, std::optional<size_t>) = 0;
+    virtual void Map(std::shared_ptr<const uint8_t>, size_t, size_t) = 0;
  
     virtual void SwitchBank(size_t, size_t) = 0;
     virtual void SetSecurityLevel(SecurityLevel) = 0;
@@ -36,6 +87,9 @@ public:
     
     virtual void RegisterMemoryMappedRegister(std::unique_ptr<interfaces::MemoryMappedRegister>, size_t, PrivilegeMode) = 0;
     virtual void UnregisterMemoryMappedRegister(size_t, PrivilegeMode) = 0;
+
+    virtual void RegisterMemoryObserver(interfaces::MemoryObserver*) = 0;
+    virtual void UnregisterMemoryObserver(interfaces::MemoryObserver*) = 0;
 };
 
 }
\ No newline at end of file
@@ -15,8 +15,23 @@ class MemoryMappedRegister
 public:
     virtual ~MemoryMappedRegister() = default;
     virtual std::size_t Size() = 0;
-    virtual std::variant<uint8_t, uint16_t> Read() = 0;
-    virtual void Write(std::variant<uint8_t, uint16_t>) = 0;
+    virtual uint8_t ReadByte() = 0;
+    virtual void WriteByte(uint8_t) = 0;
+
+    // Variant adapters over the typed accessors, kept for the debugger-facing API. Registers are eight bits wide,
+    // so word writes keep the lower byte only
+    std::variant<uint8_t, uint16_t> Read()
+    {
+        return std::variant<uint8_t, uint16_t>{std::in_place_index<0>, ReadByte()};
+    }
+
+    void Write(std::variant<uint8_t, uint16_t> value)
+    {
+        if (std::holds_alternative<uint16_t>(value))
+            WriteByte(static_cast<uint8_t>(std::get<uint16_t>(value) & 0xFF));
+        else
+            WriteByte(std::get<uint8_t>(value));
+    }
 };
 
-}
\ No newline at end of file
+}
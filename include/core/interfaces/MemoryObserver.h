@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+#include "AddressRange.h"
+#include "SystemMode.h"
+
+namespace gbxcore::interfaces
+{
+
+class MemoryObserver
+{
+public:
+    virtual ~MemoryObserver() = default;
+    virtual void OnWrite(size_t) = 0;
+    virtual void OnBankSwitch(PrivilegeMode, AddressRange, size_t) = 0;
+    virtual void OnInvalidate() = 0;
+};
+
+}
\ No newline at end of file
@@ -19,9 +19,28 @@ class MemoryResource
 public:
     virtual ~MemoryResource() = default;
     virtual std::size_t Size() = 0;
-    virtual std::variant<uint8_t, uint16_t> Read(size_t, MemoryAccessType) = 0;
-    virtual void Write(std::variant<uint8_t, uint16_t>, size_t) = 0;
+    virtual uint8_t ReadByte(size_t) = 0;
+    virtual uint16_t ReadWord(size_t) = 0;
+    virtual void WriteByte(uint8_t, size_t) = 0;
+    virtual void WriteWord(uint16_t, size_t) = 0;
     virtual void Load(std::shared_ptr<uint8_t*>, std::size_t, std::optional<size_t>) = 0;
+
+    // Variant adapters over the typed accessors, kept for the debugger-facing API
+    std::variant<uint8_t, uint16_t> Read(size_t address, MemoryAccessType accessType)
+    {
+        if (accessType == MemoryAccessType::Byte)
+            return std::variant<uint8_t, uint16_t>{std::in_place_index<0>, ReadByte(address)};
+        else
+            return std::variant<uint8_t, uint16_t>{std::in_place_index<1>, ReadWord(address)};
+    }
+
+    void Write(std::variant<uint8_t, uint16_t> value, size_t address)
+    {
+        if (std::holds_alternative<uint8_t>(value))
+            WriteByte(std::get<uint8_t>(value), address);
+        else
+            WriteWord(std::get<uint16_t>(value), address);
+    }
 };
 
-}
\ No newline at end of file
+}
@@ -15,6 +15,18 @@ enum class Flag
     CY = 4,
 };
 
+// Flag-producing operations whose flags can be evaluated after the fact from their operands
+enum class FlagOperation : uint8_t
+{
+    Add,
+    Subtract,
+    Increment,
+    Decrement,
+    And,
+    Or,
+    Xor,
+};
+
 enum class Register
 {
     // Basic Registers
@@ -67,6 +79,7 @@ public:
     virtual inline void ClearFlag(Flag) = 0;
     virtual inline uint8_t ReadFlag(Flag) = 0;
     virtual inline void WriteFlag(Flag, uint8_t) = 0;
+    virtual void DeferFlags(FlagOperation, uint8_t, uint8_t, uint8_t) = 0;
 
     inline static uint8_t ToInstructionSource(interfaces::Register reg)
     {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <optional>
 #include <string>
 #include <variant>
@@ -10,17 +11,41 @@
 
 namespace gbxcore::interfaces
 {
+
+enum class StopReason
+{
+    BudgetExhausted,
+    Breakpoint,
+    Halt,
+    Cancelled,
+    Error
+};
+
+// Polled by the batched run methods once every few hundred instructions; returning true stops the batch.
+typedef std::function<bool()> CancellationCheck;
     
 struct Runtime
 {
     virtual ~Runtime() = default;
     virtual void Run() = 0;
+    virtual StopReason RunFor(uint64_t, CancellationCheck = nullptr) = 0;
+    virtual StopReason RunInstructions(uint64_t, CancellationCheck = nullptr) = 0;
+    virtual StopReason RunFrame(CancellationCheck = nullptr) = 0;
+
+    virtual void SetBreakpoint(uint16_t) = 0;
+    virtual void ClearBreakpoint(uint16_t) = 0;
+    // Why the last batch stopped with StopReason::Error
+    [[nodiscard]] virtual const std::string& LastError() const = 0;
+    // Instructions executed since the runtime was created
+    [[nodiscard]] virtual uint64_t Instructions() const = 0;
+
     virtual void LoadGame(std::string) = 0;
     virtual void LoadBIOS(std::string) = 0;
     
     virtual gbxcore::SecurityLevel SecurityLevel() = 0;
     virtual void SetSecurityLevel(gbxcore::SecurityLevel) = 0;
 
+    // Reads from a cartridge bank (bank 1 is the first switchable one) without changing the bank that is mapped
     virtual std::variant<uint8_t, uint16_t> ReadROM(uint16_t, std::optional<uint16_t>, interfaces::MemoryAccessType) = 0;
     
     virtual std::variant<uint8_t, uint16_t> ReadRegister(Register) = 0;
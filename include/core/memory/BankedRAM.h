@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "BankedROM.h"
+#include "GBXCoreExceptions.h"
+
+namespace gbxcore::memory
+{
+
+// Banked, writable memory (e.g. cartridge RAM). While disabled it reads as 0xFF, ignores writes and exposes no
+// directly addressable bank.
+class BankedRAM : public BankedROM
+{
+public:
+    BankedRAM(size_t, size_t);
+    virtual ~BankedRAM() = default;
+
+    uint8_t ReadByte(size_t) override;
+    uint16_t ReadWord(size_t) override;
+    void WriteByte(uint8_t, size_t) override;
+    void WriteWord(uint16_t, size_t) override;
+    void Map(std::shared_ptr<const uint8_t>, std::size_t) override;
+
+    uint8_t* Data() override;
+    bool IsWritable() override;
+
+    void Enable(bool);
+    bool IsEnabled();
+
+private:
+    bool _enabled{true};
+};
+
+}
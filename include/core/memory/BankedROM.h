@@ -5,34 +5,44 @@
 #include <variant>
 
 #include "ROM.h"
+#include "BankedMemoryResource.h"
 #include "GBXCoreExceptions.h"
 #include "MemoryResource.h"
 
 namespace gbxcore::memory
 {
 
-class BankedROM : public ROM
+class BankedROM : public ROM, public interfaces::BankedMemoryResource
 {
 public:
     BankedROM(size_t, size_t);
     virtual ~BankedROM() = default;
 
-    std::variant<uint8_t, uint16_t> Read(size_t, interfaces::MemoryAccessType) override;
-    void Write(std::variant<uint8_t, uint16_t>, size_t) override;
+    uint8_t ReadByte(size_t) override;
+    uint16_t ReadWord(size_t) override;
+    void WriteByte(uint8_t, size_t) override;
+    void WriteWord(uint16_t, size_t) override;
     void Load(std::shared_ptr<uint8_t*>, std::size_t, std::optional<size_t>) override;
+    void Map(std::shared_ptr<const uint8_t>, std::size_t) override;
+    uint8_t* Data() override;
 
     size_t BankSize();
     size_t PhysicalResourceSize();
     size_t Size() override;
-    size_t BankCount();
-    size_t CurrentBank();
-    void SelectBank(size_t);
+    size_t BankCount() override;
+    size_t CurrentBank() override;
+    void SelectBank(size_t) override;
 
-private:
-    void EvaluateAddress(size_t, interfaces::MemoryAccessType);
+protected:
+    template<interfaces::MemoryAccessType AccessType>
+    inline void EvaluateAddress(size_t);
+    [[noreturn]] void ThrowOutOfBank(size_t, interfaces::MemoryAccessType);
+    void UpdateBankBase();
 
     size_t _bankSize{};
     size_t _activeBank{};
+    size_t _capacity{};
+    uint8_t* _bankBase{};
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+
+#include "BankedRAM.h"
+#include "GBXCoreExceptions.h"
+#include "SaveFile.h"
+
+namespace gbxcore::memory
+{
+
+// Cartridge RAM that can be backed by a save file. Once attached, the file mapping is the RAM itself and every write
+// marks its block of the file dirty.
+class BatteryBackedRAM : public BankedRAM
+{
+public:
+    BatteryBackedRAM(size_t, size_t);
+    virtual ~BatteryBackedRAM() = default;
+
+    void WriteByte(uint8_t, size_t) override;
+    void WriteWord(uint16_t, size_t) override;
+    uint8_t* Data() override;
+
+    void Attach(std::unique_ptr<gbxcommons::SaveFile>);
+    void Detach();
+    [[nodiscard]] gbxcommons::SaveFile* Save();
+
+private:
+    std::unique_ptr<gbxcommons::SaveFile> _saveFile;
+};
+
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <variant>
+#include <vector>
+
+#include "GBXCoreExceptions.h"
+#include "MemoryControllerInterface.h"
+#include "SystemMode.h"
+
+namespace gbxcore::memory
+{
+
+typedef struct JournaledWrite_t
+{
+    size_t Address;
+    std::optional<uint8_t> OldValue;
+    std::optional<uint8_t> NewValue;
+}
+JournaledWrite;
+
+class JournalingMemoryController : public interfaces::MemoryControllerInterface
+{
+public:
+    explicit JournalingMemoryController(interfaces::MemoryControllerInterface*);
+    virtual ~JournalingMemoryController() = default;
+
+    std::variant<uint8_t, uint16_t> Read(size_t, interfaces::MemoryAccessType) override;
+    void Write(std::variant<uint8_t, uint16_t>, size_t) override;
+    [[nodiscard]] uint8_t ReadByte(size_t) override;
+    [[nodiscard]] uint16_t ReadWord(size_t) override;
+    void WriteByte(uint8_t, size_t) override;
+    void WriteWord(uint16_t, size_t) override;
+    [[nodiscard]] uint8_t ReadByteAs(PrivilegeMode, size_t) override;
+    void ReadBlock(size_t, std::span<uint8_t>) override;
+    void WriteBlock(std::span<const uint8_t>, size_t) override;
+    void CopyBlock(size_t, size_t, size_t) override;
+    [[nodiscard]] bool HasSideEffects(size_t) override;
+    [[nodiscard]] bool IsPrefetchable(size_t) override;
+    void PokeByte(uint8_t, size_t) override;
+    void Load(std::unique_ptr<uint8_t*>, size_t, size_t, std::optional<size_t>) override;
+    void Map(std::shared_ptr<const uint8_t>, size_t, size_t) override;
+
+    void SwitchBank(size_t, size_t) override;
+    void SetSecurityLevel(gbxcore::SecurityLevel) override;
+    gbxcore::SecurityLevel SecurityLevel() override;
+
+    size_t RegisterMemoryResource(std::unique_ptr<interfaces::MemoryResource>, AddressRange, PrivilegeMode) override;
+    void UnregisterMemoryResource(size_t, PrivilegeMode) override;
+
+    void RegisterMemoryMappedRegister(std::unique_ptr<interfaces::MemoryMappedRegister>, size_t, PrivilegeMode) override;
+    void UnregisterMemoryMappedRegister(size_t, PrivilegeMode) override;
+
+    void RegisterMemoryObserver(interfaces::MemoryObserver*) override;
+    void UnregisterMemoryObserver(interfaces::MemoryObserver*) override;
+
+    [[nodiscard]] const std::vector<JournaledWrite>& Journal();
+    [[nodiscard]] bool HasJournaledSideEffects();
+    void ClearJournal();
+    void Rollback();
+
+private:
+    inline std::optional<uint8_t> TryRead(size_t);
+    inline size_t BeginJournalEntries(size_t, size_t);
+    inline void CompleteJournalEntries(size_t);
+
+    interfaces::MemoryControllerInterface* _memoryController;
+    std::vector<JournaledWrite> _journal;
+    bool _sideEffects{};
+};
+
+}
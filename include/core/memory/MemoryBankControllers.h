@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "AddressRange.h"
+#include "BankedMemoryResource.h"
+#include "BankedRAM.h"
+#include "MemoryBankController.h"
+
+namespace gbxcore::memory
+{
+
+// Cartridge header fields
+const size_t CartridgeTypeAddress = 0x0147;
+const size_t CartridgeRAMSizeAddress = 0x0149;
+
+enum class MemoryBankControllerType
+{
+    None,
+    MBC1,
+    MBC3,
+    MBC5,
+    Unsupported
+};
+
+[[nodiscard]] MemoryBankControllerType MemoryBankControllerTypeOf(uint8_t);
+[[nodiscard]] size_t ExternalRAMBankCount(uint8_t);
+
+// State and bank selection shared by the MBC1/MBC3/MBC5 controllers. ROM banks are numbered as in the cartridge
+// (the banked resource spans the whole ROM image) and bank numbers wrap around the number of banks present.
+class CartridgeMemoryBankController : public interfaces::MemoryBankController
+{
+public:
+    CartridgeMemoryBankController(interfaces::BankedMemoryResource*, BankedRAM*, size_t);
+    virtual ~CartridgeMemoryBankController() = default;
+
+    AddressRange ControlRange() override;
+    size_t ROMBank() override;
+    size_t RAMBank() override;
+    bool IsRAMEnabled() override;
+
+protected:
+    void SelectROMBank(size_t);
+    void SelectRAMBank(size_t);
+    void EnableRAM(bool);
+
+    interfaces::BankedMemoryResource* _rom;
+    BankedRAM* _ram;
+    size_t _ramBankCount;
+    size_t _romBank{};
+    size_t _ramBank{};
+    bool _ramEnabled{};
+};
+
+class MBC1 final : public CartridgeMemoryBankController
+{
+public:
+    MBC1(interfaces::BankedMemoryResource*, BankedRAM*, size_t);
+    void Write(uint16_t, uint8_t) override;
+
+private:
+    inline void UpdateBanks();
+
+    uint8_t _lowerBankBits{0x01};
+    uint8_t _upperBankBits{};
+    bool _ramBankingMode{};
+};
+
+// The real-time clock is not emulated: selecting one of its registers unmaps the external RAM window
+class MBC3 final : public CartridgeMemoryBankController
+{
+public:
+    MBC3(interfaces::BankedMemoryResource*, BankedRAM*, size_t);
+    void Write(uint16_t, uint8_t) override;
+
+private:
+    bool _clockSelected{};
+    bool _accessEnabled{};
+};
+
+class MBC5 final : public CartridgeMemoryBankController
+{
+public:
+    MBC5(interfaces::BankedMemoryResource*, BankedRAM*, size_t);
+    void Write(uint16_t, uint8_t) override;
+
+private:
+    uint16_t _romBankNumber{0x01};
+};
+
+[[nodiscard]] std::unique_ptr<interfaces::MemoryBankController> CreateMemoryBankController(MemoryBankControllerType, interfaces::BankedMemoryResource*, BankedRAM*, size_t);
+
+}
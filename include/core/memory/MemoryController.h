@@ -1,20 +1,29 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cstring>
+#include <iostream>
 #include <memory>
 #include <optional>
+#include <span>
 #include <sstream>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
+#include "BankedMemoryResource.h"
 #include "BankedROM.h"
+#include "BusMaster.h"
+#include "DirectMemoryResource.h"
 #include "GBXCoreExceptions.h"
+#include "MappableMemoryResource.h"
+#include "MemoryBankController.h"
 #include "MemoryControllerInterface.h"
 #include "MemoryResource.h"
 #include "SystemMode.h"
 
 #include <map>
-#include <memory>
 
 namespace gbxcore::memory
 {
@@ -24,6 +33,10 @@ typedef struct RegisteredMemoryResource_t
     std::unique_ptr<interfaces::MemoryResource> Resource;
     AddressRange Range;
     size_t ID;
+    interfaces::BankedMemoryResource* Banked;
+    interfaces::DirectMemoryResource* Direct;
+    uint8_t* MappedData;
+    size_t MappedBank;
 }
 RegisteredMemoryResource;
 
@@ -34,6 +47,75 @@ typedef struct RegisteredMemoryMappedRegister_t
 }
 RegisteredMemoryMappedRegister;
 
+const size_t MemoryPageSize = 0x100;
+const size_t MemoryPageCount = 0x100;
+
+enum class PageMapping : uint8_t
+{
+    Fault,
+    Direct,
+    Resource,
+    Fragmented,
+    Locked
+};
+
+// How accesses to unmapped addresses and writes to read-only memory are reported
+enum class MemoryFaultPolicy
+{
+    Throw,
+    Log,
+    OpenBus
+};
+
+// One entry per 256-byte page of the address space. Direct pages point at the backing bytes of the page,
+// Resource pages (banked or otherwise opaque resources) forward to the resource and Fragmented pages, which
+// are shared by several resources or only partially covered, fall back to searching the resource list.
+// Unmapped pages are Fault pages, or read-only Direct pages over an all-0xFF page under the OpenBus policy.
+// Banked resources that expose their active bank are Direct pages too, remapped whenever the bank changes.
+// BankControl pages route writes that would otherwise fail to the memory bank controller.
+// Locked pages are the ones a bus master has taken away from the CPU; they read as 0xFF and ignore writes.
+typedef struct MemoryPage_t
+{
+    uint8_t* Data;
+    interfaces::MemoryResource* Resource;
+    size_t Offset;
+    PageMapping Mapping;
+    bool Writable;
+    bool Registers;
+    bool BankControl;
+}
+MemoryPage;
+
+typedef std::array<MemoryPage, MemoryPageCount> PageTable;
+
+// Registers of the IO page (0xFF00-0xFFFF) are dispatched through a dense array; registers mapped anywhere else are looked up by address
+const size_t IORegisterPage = 0xFF;
+typedef std::array<interfaces::MemoryMappedRegister*, MemoryPageSize> IORegisterTable;
+
+// The address space as seen from one privilege level. The views are rebuilt whenever a resource or register
+// is (un)registered, so switching the security level only swaps the active view.
+typedef struct MemoryView_t
+{
+    PageTable Pages;
+    IORegisterTable IORegisters;
+    std::vector<RegisteredMemoryResource>* Resources;
+    std::map<uint16_t, RegisteredMemoryMappedRegister>* Registers;
+    interfaces::MemoryBankController* BankController;
+}
+MemoryView;
+
+const size_t MemoryViewCount = 3;
+
+typedef struct BankedResource_t
+{
+    RegisteredMemoryResource* Registered;
+    PrivilegeMode Owner;
+}
+BankedResource;
+
+template<interfaces::MemoryAccessType AccessType>
+using MemoryValue = std::conditional_t<AccessType == interfaces::MemoryAccessType::Byte, uint8_t, uint16_t>;
+
 typedef struct ResourceIndexAndAddress_t
 {
     uint8_t ResourceIndex;
@@ -44,40 +126,106 @@ ResourceIndexAndAddress;
 class MemoryController : public interfaces::MemoryControllerInterface
 {
 public:
-    MemoryController() = default;
+    MemoryController();
     virtual ~MemoryController() = default;
 
     [[nodiscard]] std::variant<uint8_t, uint16_t> Read(size_t, interfaces::MemoryAccessType) override;
     void Write(std::variant<uint8_t, uint16_t>, size_t) override;
+    [[nodiscard]] uint8_t ReadByte(size_t) override;
+    [[nodiscard]] uint16_t ReadWord(size_t) override;
+    void WriteByte(uint8_t, size_t) override;
+    void WriteWord(uint16_t, size_t) override;
+    [[nodiscard]] uint8_t ReadByteAs(PrivilegeMode, size_t) override;
+    void ReadBlock(size_t, std::span<uint8_t>) override;
+    void WriteBlock(std::span<const uint8_t>, size_t) override;
+    void CopyBlock(size_t, size_t, size_t) override;
+    [[nodiscard]] bool HasSideEffects(size_t) override;
+    [[nodiscard]] bool IsPrefetchable(size_t) override;
+    void PokeByte(uint8_t, size_t) override;
     void Load(std::unique_ptr<uint8_t*>, size_t, size_t, std::optional<size_t>) override;
+    void Map(std::shared_ptr<const uint8_t>, size_t, size_t) override;
     
     void SwitchBank(size_t, size_t) override;
     void SetSecurityLevel(gbxcore::SecurityLevel) override;
     gbxcore::SecurityLevel SecurityLevel() override;
 
+    void SetFaultPolicy(MemoryFaultPolicy);
+    [[nodiscard]] MemoryFaultPolicy FaultPolicy();
+
+    void SetMemoryBankController(std::unique_ptr<interfaces::MemoryBankController>, PrivilegeMode);
+    [[nodiscard]] interfaces::MemoryBankController* BankController();
+
+    void LockBus(interfaces::BusMaster*, AddressRange);
+    void ReleaseBus(interfaces::BusMaster*);
+    void BusMasterCopyBlock(size_t, size_t, size_t);
+    [[nodiscard]] bool IsBusLocked();
+
     size_t RegisterMemoryResource(std::unique_ptr<interfaces::MemoryResource>, AddressRange,  PrivilegeMode) override;
     void UnregisterMemoryResource(size_t, PrivilegeMode) override;
 
     void RegisterMemoryMappedRegister(std::unique_ptr<interfaces::MemoryMappedRegister>, size_t, PrivilegeMode) override;
     void UnregisterMemoryMappedRegister(size_t, PrivilegeMode) override;
 
+    void RegisterMemoryObserver(interfaces::MemoryObserver*) override;
+    void UnregisterMemoryObserver(interfaces::MemoryObserver*) override;
+
 private:
+    template<interfaces::MemoryAccessType AccessType>
+    inline MemoryValue<AccessType> ReadAt(MemoryView&, size_t);
+    template<interfaces::MemoryAccessType AccessType>
+    inline void WriteAt(MemoryView&, MemoryValue<AccessType>, size_t);
+    template<interfaces::MemoryAccessType AccessType>
+    inline MemoryValue<AccessType> ReadFrom(interfaces::MemoryResource*, size_t);
+    template<interfaces::MemoryAccessType AccessType>
+    inline void WriteTo(interfaces::MemoryResource*, MemoryValue<AccessType>, size_t);
+    inline MemoryView& TransferView(bool);
+    inline void CopyBlockThrough(bool, size_t, size_t, size_t);
+    inline size_t DirectRun(MemoryView&, size_t, size_t, bool);
+    inline uint8_t* DirectData(MemoryView&, size_t);
+
+    uint16_t HandleFault(size_t, const char*);
+    void HandleReadOnlyWrite(size_t);
+
     inline void SortResources();
     inline void DetectMisfit(interfaces::MemoryResource*, AddressRange);
     inline void DetectOverlap(AddressRange);
     inline std::vector<RegisteredMemoryResource>* SelectResource();
-    inline std::map<uint16_t, RegisteredMemoryMappedRegister>* SelectRegisterSource();
     inline std::map<uint16_t, RegisteredMemoryMappedRegister>* GetRegisterSource(PrivilegeMode);
-    inline std::map<uint16_t, RegisteredMemoryMappedRegister>::iterator IsRegisterAddress(size_t);
+    inline interfaces::MemoryMappedRegister* FindRegister(MemoryView&, size_t);
+    inline MemoryView& SelectView(PrivilegeMode);
+    inline void BuildPageTables();
+    inline void BuildView(MemoryView&, std::vector<RegisteredMemoryResource>&, std::map<uint16_t, RegisteredMemoryMappedRegister>&, interfaces::MemoryBankController*);
+    template<interfaces::MemoryAccessType AccessType>
+    inline void WriteBankControl(MemoryView&, MemoryValue<AccessType>, size_t);
+    inline void RefreshBanks();
+    inline void RemapPages(RegisteredMemoryResource&);
+    inline bool BusHeld();
+    inline void UnlockBus();
+    inline void BuildLockedView();
+    inline void NotifyWrite(size_t);
+    inline void NotifyWrite(size_t, size_t);
+    inline void NotifyInvalidate();
 
     std::optional<ResourceIndexAndAddress> CalculateLocalAddress(size_t address);
+    std::optional<ResourceIndexAndAddress> CalculateLocalAddress(std::vector<RegisteredMemoryResource>&, size_t address);
     std::vector<RegisteredMemoryResource> _userResources; 
     std::vector<RegisteredMemoryResource> _systemResources; 
     std::map<uint16_t, RegisteredMemoryMappedRegister> _systemRegisters;
     std::map<uint16_t, RegisteredMemoryMappedRegister> _userRegisters;
     std::map<uint16_t, RegisteredMemoryMappedRegister> _bothRegisters;
+    std::vector<interfaces::MemoryObserver*> _observers;
+    std::array<MemoryView, MemoryViewCount> _views{};
+    MemoryView* _activeView{};
+    std::vector<BankedResource> _bankedResources;
+    std::unique_ptr<interfaces::MemoryBankController> _bankController;
+    PrivilegeMode _bankControllerOwner{};
+    MemoryView _lockedView{};
+    interfaces::BusMaster* _busMaster{};
+    std::optional<AddressRange> _busAccessibleRange;
 
     gbxcore::SecurityLevel _level{};
+    MemoryFaultPolicy _faultPolicy{};
+    std::array<uint8_t, MemoryPageSize> _openBusPage{};
     size_t _resourcesID;
 };
 
@@ -21,10 +21,14 @@ public:
     RAM(std::size_t);
     virtual ~RAM() = default;
 
-    virtual void Write(std::variant<uint8_t, uint16_t>, size_t) override;
+    virtual void WriteByte(uint8_t, size_t) override;
+    virtual void WriteWord(uint16_t, size_t) override;
+    virtual void Map(std::shared_ptr<const uint8_t>, std::size_t) override;
+    virtual bool IsWritable() override;
 
 private:
-    inline void CheckWriteConditions(std::variant<uint8_t, uint16_t>, size_t);
+    template<interfaces::MemoryAccessType AccessType>
+    inline void CheckWriteConditions(size_t);
     
 };
 
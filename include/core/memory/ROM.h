@@ -9,29 +9,44 @@
 #include <sstream>
 #include <variant>
 
+#include "DirectMemoryResource.h"
 #include "GBXCoreExceptions.h"
+#include "MappableMemoryResource.h"
 #include "MemoryResource.h"
+#include "ZeroPages.h"
 
 namespace gbxcore::memory
 {
     
-class ROM : public interfaces::MemoryResource
+class ROM : public interfaces::MemoryResource, public interfaces::DirectMemoryResource, public interfaces::MappableMemoryResource
 {
 public:
     ROM(std::size_t);
     virtual ~ROM() = default;
 
-    virtual std::variant<uint8_t, uint16_t> Read(size_t, interfaces::MemoryAccessType) override;
-    virtual void Write(std::variant<uint8_t, uint16_t>, size_t) override;
+    virtual uint8_t ReadByte(size_t) override;
+    virtual uint16_t ReadWord(size_t) override;
+    virtual void WriteByte(uint8_t, size_t) override;
+    virtual void WriteWord(uint16_t, size_t) override;
 
     virtual std::size_t Size() override;
     virtual void Load(std::shared_ptr<uint8_t*>, std::size_t, std::optional<size_t>) override;
+    virtual void Map(std::shared_ptr<const uint8_t>, std::size_t) override;
+
+    virtual uint8_t* Data() override;
+    virtual bool IsWritable() override;
 
 protected:
-    inline void CheckReadConditions(size_t, interfaces::MemoryAccessType);
+    template<interfaces::MemoryAccessType AccessType>
+    inline void CheckReadConditions(size_t);
+    [[noreturn]] void ThrowBadAddress(const char*, size_t);
+    void CopyFrom(const uint8_t*, std::size_t);
+    void Materialize();
 
     std::size_t _size;
-    std::unique_ptr<uint8_t[]> _rom;
+    ZeroPages<uint8_t> _rom;
+    std::shared_ptr<const uint8_t> _mapping;
+    uint8_t* _data;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+namespace gbxcore::memory
+{
+
+typedef struct ROMImage_t
+{
+    std::shared_ptr<const uint8_t> Data;
+    size_t Size;
+}
+ROMImage;
+
+// Process-wide registry of read-only ROM images keyed by content hash. Instances loading the same cartridge or BIOS
+// share one image (and only keep their own bank selection), and an image is released with its last user.
+class ROMImageRegistry
+{
+public:
+    [[nodiscard]] static ROMImageRegistry& Instance();
+
+    // Images are padded with zeros to a multiple of the granularity, so that they can back whole ROM banks
+    [[nodiscard]] ROMImage Acquire(std::shared_ptr<const uint8_t>, size_t, size_t);
+    [[nodiscard]] size_t Count();
+
+    [[nodiscard]] static uint64_t Hash(const uint8_t*, size_t);
+
+private:
+    typedef std::tuple<uint64_t, size_t, size_t> ImageKey;
+
+    typedef struct RegisteredImage_t
+    {
+        std::weak_ptr<const uint8_t> Data;
+        size_t Size;
+        size_t ContentSize;
+    }
+    RegisteredImage;
+
+    ROMImageRegistry() = default;
+
+    inline static ROMImage CreateImage(std::shared_ptr<const uint8_t>, size_t, size_t);
+
+    std::map<ImageKey, RegisteredImage> _images;
+    std::mutex _imagesMutex;
+};
+
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace gbxcore::memory
+{
+
+// Blocks of at least this size come from demand-zero anonymous mappings; smaller ones from calloc
+const size_t ZeroPagesMappingThreshold = 0x1000;
+
+struct ZeroPagesDeleter
+{
+    size_t Size;
+    void operator()(void*) const;
+};
+
+template<typename T>
+using ZeroPages = std::unique_ptr<T[], ZeroPagesDeleter>;
+
+[[nodiscard]] void* AllocateZeroedBytes(size_t);
+
+// Zero-initialized storage that touches no memory when allocated: the kernel only materializes (zeroed) pages
+// the first time they are accessed, so idle resources cost address space rather than resident memory.
+template<typename T>
+[[nodiscard]] ZeroPages<T> AllocateZeroPages(size_t count)
+{
+    static_assert(std::is_trivial_v<T>, "zero pages can only hold trivial types");
+    return ZeroPages<T>(static_cast<T*>(AllocateZeroedBytes(count * sizeof(T))), ZeroPagesDeleter{count * sizeof(T)});
+}
+
+}
@@ -19,7 +19,7 @@ public:
     CGBBackgroundPaletteDataRegister(gbxcore::interfaces::VideoControllerInterface*);
     virtual ~CGBBackgroundPaletteDataRegister() = default;
     
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
     void RegisterIndexRegister(CGBBackgroundPaletteIndexRegister*);
     void SetCurrentColorIndex(uint8_t);
     uint8_t CurrentColorIndex();
@@ -19,7 +19,7 @@ public:
     CGBBackgroundPaletteIndexRegister(gbxcore::interfaces::VideoControllerInterface*);
     virtual ~CGBBackgroundPaletteIndexRegister() = default;
     
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
     void RegisterDataRegister(CGBBackgroundPaletteDataRegister*);
     void ReportDataWrite();
     bool AutoIncrementEnabled();
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "EightBitMemoryMappedRegisterBase.h"
+
+namespace gbxcore::memory::registers
+{
+
+// HDMA1-HDMA4 are write-only halves of the VRAM DMA source and destination addresses
+class CGBHDMAAddressRegister : public EightBitMemoryMappedRegisterBase
+{
+public:
+    CGBHDMAAddressRegister() = default;
+    virtual ~CGBHDMAAddressRegister() = default;
+
+    uint8_t ReadByte() override;
+    [[nodiscard]] uint8_t Value();
+};
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "BusMaster.h"
+#include "CGBHDMAAddressRegister.h"
+#include "EightBitMemoryMappedRegisterBase.h"
+#include "MemoryController.h"
+#include "SystemConstants.h"
+
+namespace gbxcore::memory::registers
+{
+
+// HDMA5 starts, and reports the progress of, VRAM DMA transfers. General purpose transfers run at once; HBlank
+// transfers move one 16 byte block every time OnHBlank is signalled. The CPU is stalled for the duration of each copy.
+class CGBHDMAControlRegister : public EightBitMemoryMappedRegisterBase
+{
+public:
+    CGBHDMAControlRegister(gbxcore::memory::MemoryController*, gbxcore::interfaces::CycleStall);
+    virtual ~CGBHDMAControlRegister() = default;
+
+    uint8_t ReadByte() override;
+    void WriteByte(uint8_t) override;
+    void RegisterAddressRegisters(CGBHDMAAddressRegister*, CGBHDMAAddressRegister*, CGBHDMAAddressRegister*, CGBHDMAAddressRegister*);
+
+    void OnHBlank();
+    [[nodiscard]] bool IsHBlankTransferActive();
+
+private:
+    inline void LoadAddresses();
+    inline void TransferBlocks(size_t);
+
+    gbxcore::memory::MemoryController* _memoryController;
+    gbxcore::interfaces::CycleStall _stall;
+    CGBHDMAAddressRegister* _sourceHighRegisterReference{};
+    CGBHDMAAddressRegister* _sourceLowRegisterReference{};
+    CGBHDMAAddressRegister* _destinationHighRegisterReference{};
+    CGBHDMAAddressRegister* _destinationLowRegisterReference{};
+
+    size_t _source{};
+    size_t _destination{};
+    size_t _remainingBlocks{};
+    bool _hblankTransferActive{};
+};
+
+}
@@ -19,7 +19,7 @@ public:
     CGBObjectPaletteDataRegister(gbxcore::interfaces::VideoControllerInterface*);
     virtual ~CGBObjectPaletteDataRegister() = default;
     
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
     void RegisterIndexRegister(CGBObjectPaletteIndexRegister*);
     void SetCurrentColorIndex(uint8_t);
     uint8_t CurrentColorIndex();
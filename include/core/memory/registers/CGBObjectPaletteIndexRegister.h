@@ -19,7 +19,7 @@ public:
     CGBObjectPaletteIndexRegister(gbxcore::interfaces::VideoControllerInterface*);
     virtual ~CGBObjectPaletteIndexRegister() = default;
     
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
     void RegisterDataRegister(CGBObjectPaletteDataRegister*);
     void ReportDataWrite();
     bool AutoIncrementEnabled();
@@ -17,7 +17,7 @@ public:
     DMGBackgroundPalleteRegister(gbxcore::interfaces::VideoControllerInterface*);
     virtual ~DMGBackgroundPalleteRegister() = default;
     
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
 
 private:
     gbxcore::interfaces::VideoControllerInterface* _videoController;
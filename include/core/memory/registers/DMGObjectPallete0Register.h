@@ -17,7 +17,7 @@ public:
     DMGObjectPallete0Register(gbxcore::interfaces::VideoControllerInterface*);
     virtual ~DMGObjectPallete0Register() = default;
     
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
 
 private:
     gbxcore::interfaces::VideoControllerInterface* _videoController;
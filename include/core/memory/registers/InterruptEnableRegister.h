@@ -14,8 +14,8 @@ public:
     virtual ~InterruptEnableRegister() = default;
     
     std::size_t Size() override;
-    std::variant<uint8_t, uint16_t> Read() override;
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    uint8_t ReadByte() override;
+    void WriteByte(uint8_t) override;
 
 private:
     uint8_t _value{};
@@ -15,7 +15,7 @@ public:
     LCDBackgroundScrollXRegister(gbxcore::interfaces::VideoControllerInterface*);
     virtual ~LCDBackgroundScrollXRegister() = default;
     
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
 
 private:
     gbxcore::interfaces::VideoControllerInterface* _videoController;
@@ -15,7 +15,7 @@ public:
     LCDBackgroundScrollYRegister(gbxcore::interfaces::VideoControllerInterface*);
     virtual ~LCDBackgroundScrollYRegister() = default;
     
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
 
 private:
     gbxcore::interfaces::VideoControllerInterface* _videoController;
@@ -15,7 +15,7 @@ public:
     LCDControlRegister(gbxcore::interfaces::VideoControllerInterface*);
     virtual ~LCDControlRegister() = default;
     
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
 
 private:
     void ProcessValue(uint8_t);
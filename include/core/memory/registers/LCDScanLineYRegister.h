@@ -16,7 +16,7 @@ public:
     virtual ~LCDScanLineYRegister() = default;
     
     // Write is the method used outside of the video controller (thus as seen in the memory controller)
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
 
     // This method gets called by the video controller, as the scan lines are updated during ther screen update.
     void UpdateScanLineValue(uint8_t);
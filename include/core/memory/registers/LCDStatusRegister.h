@@ -15,7 +15,7 @@ public:
     LCDStatusRegister(gbxcore::interfaces::VideoControllerInterface*);
     virtual ~LCDStatusRegister() = default;
     
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
 
 private:
     inline void DecodeRegisterValue(uint8_t, uint8_t);
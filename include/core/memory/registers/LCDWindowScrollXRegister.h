@@ -15,7 +15,7 @@ public:
     LCDWindowScrollXRegister(gbxcore::interfaces::VideoControllerInterface*);
     virtual ~LCDWindowScrollXRegister() = default;
     
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
 
 private:
     gbxcore::interfaces::VideoControllerInterface* _videoController;
@@ -15,7 +15,7 @@ public:
     LCDWindowScrollYRegister(gbxcore::interfaces::VideoControllerInterface*);
     virtual ~LCDWindowScrollYRegister() = default;
     
-    void Write(std::variant<uint8_t, uint16_t>) override;
+    void WriteByte(uint8_t) override;
 
 private:
     gbxcore::interfaces::VideoControllerInterface* _videoController;
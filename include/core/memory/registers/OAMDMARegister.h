@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+#include "BusMaster.h"
+#include "EightBitMemoryMappedRegisterBase.h"
+#include "EventScheduler.h"
+#include "MemoryController.h"
+#include "SystemConstants.h"
+
+namespace gbxcore::memory::registers
+{
+
+// Writing the source page (XX) copies XX00-XX9F into OAM and takes the bus from the CPU for the length of the transfer
+class OAMDMARegister : public EightBitMemoryMappedRegisterBase, public gbxcore::interfaces::BusMaster
+{
+public:
+    OAMDMARegister(gbxcore::memory::MemoryController*, gbxcore::interfaces::CycleSource);
+    virtual ~OAMDMARegister() = default;
+
+    void WriteByte(uint8_t) override;
+    bool HoldsBus() override;
+    void RegisterScheduler(gbxcore::EventScheduler*);
+
+    [[nodiscard]] uint64_t TransferEnd();
+
+private:
+    gbxcore::memory::MemoryController* _memoryController;
+    gbxcore::interfaces::CycleSource _cycles;
+    gbxcore::EventScheduler* _scheduler{};
+    uint64_t _transferEnd{};
+};
+
+}
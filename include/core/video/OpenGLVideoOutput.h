@@ -11,6 +11,7 @@
 #include "RAM.h"
 #include "SystemConstants.h"
 #include "VideoOutputInterface.h"
+#include "ZeroPages.h"
 
 namespace gbxcore::video
 {
@@ -66,7 +67,9 @@ protected:
     GLuint _texture;
 
     // The size of the frame pixels needs to be larger. Only part of it will be coppied to the OpenGL Viewport Buffer.
-    gbxcore::interfaces::RGBColor _gbxFramePixels[gbxcore::constants::DMGBCMaxBackgroundHorizontalTileCount * gbxcore::constants::DMGBCMaxBackgroundVerticalTileCount * 64];
+    // It is kept out of line in demand-zero pages, so that instances that never render do not pay for it.
+    constexpr static size_t GBXFramePixelCount = gbxcore::constants::DMGBCMaxBackgroundHorizontalTileCount * gbxcore::constants::DMGBCMaxBackgroundVerticalTileCount * 64;
+    gbxcore::memory::ZeroPages<gbxcore::interfaces::RGBColor> _gbxFramePixels;
 
     size_t _backgroundAndWindowTileSetBase{};
     size_t _backgroundTileMapBase{};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 namespace gbxruntime::runner
 {
 
@@ -10,7 +12,7 @@ public:
     bool IsCancelled();
 
 private:
-    bool _isCancelled{};
+    std::atomic<bool> _isCancelled{};
 };
 
 }
\ No newline at end of file
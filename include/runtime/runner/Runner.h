@@ -37,6 +37,8 @@ private:
     inline void RunWithDebugger(size_t, CancellationToken&);
     inline void InitializeDebugInfraIfNeeded();
 
+    constexpr static size_t HeadlessBatchSize = 0x10000;
+
     std::shared_ptr<gbxcore::interfaces::Runtime> _runtime;    
     RunnerMode _mode;
 };
@@ -5,6 +5,7 @@ $(info -------------------------------)
 
 all:
 	$(call MakeTarget, runtime)
+	$(call MakeTarget, tracedecoder)
 
 define MakeTarget
 	$(call EnteringMessage, ${1})
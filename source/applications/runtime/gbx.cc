@@ -10,6 +10,7 @@
 #include "ArgumentsParser.h"
 #include "ApplicationOptions.h"
 #include "GameBoyX.h"
+#include "InstructionTrace.h"
 #include "GBXEmulatorExceptions.h"
 #include "GBXCommonsExceptions.h"
 
@@ -24,6 +25,8 @@ struct ApplicationConfiguration
     bool Verbose;
     string BIOSName;
     string ROMName;
+    string TraceName;
+    string SaveName;
 };
 
 ApplicationConfiguration configuration{};
@@ -33,6 +36,8 @@ ApplicationConfiguration ParseCommandLine(int argc, char** argv)
     auto parser = make_shared<ArgumentsParser>("gbx -r <ROM> [-d/--debug -i/--ip <ip> -p/--port <port> | -v/--verbose]");
     parser->RegisterOption("-r", "--rom", "Target ROM to load", OptionType::Pair, OptionRequirement::Required);
     parser->RegisterOption("-b", "--bios", "Target BIOS to load", OptionType::Pair, OptionRequirement::Required);
+    parser->RegisterOption("-t", "--trace", "Binary instruction trace file (requires GBX_TRACE_LEVEL > 0)", OptionType::Pair, OptionRequirement::Optional);
+    parser->RegisterOption("-s", "--save", "Battery-backed cartridge RAM save file", OptionType::Pair, OptionRequirement::Optional);
 
     try
     {
@@ -53,6 +58,20 @@ ApplicationConfiguration ParseCommandLine(int argc, char** argv)
         if (parser->HasBeenFound("-b"))
             configuration.BIOSName = parser->RetrieveOption("-b").Value.value();
 
+        if (parser->HasBeenFound("-t"))
+        {
+            if constexpr (!IsTraceLevelEnabled(TraceLevel::Instructions))
+            {
+                cout << "Instruction tracing is not available in this build (rebuild with GBX_TRACE_LEVEL > 0)" << '\n';
+                exit(2);
+            }
+
+            configuration.TraceName = parser->RetrieveOption("-t").Value.value();
+        }
+
+        if (parser->HasBeenFound("-s"))
+            configuration.SaveName = parser->RetrieveOption("-s").Value.value();
+
         return configuration;
     }
     catch(const GBXCommonsException& e)
@@ -89,11 +108,27 @@ void RuntimeMode(ApplicationConfiguration configuration)
     gbx->LoadGame(configuration.ROMName);
     cout << "User ROM: " << configuration.ROMName << '\n';
 
+    if (!configuration.SaveName.empty())
+    {
+        gbx->AttachSaveFile(configuration.SaveName);
+        cout << "Save File: " << configuration.SaveName << '\n';
+    }
+
+    if constexpr (IsTraceLevelEnabled(TraceLevel::Instructions))
+    {
+        if (!configuration.TraceName.empty())
+            InstructionTracer::Instance().Start(configuration.TraceName);
+    }
+
     while (cycleCounter < std::numeric_limits<size_t>::max())
     {
         gbx->Run();
         cycleCounter++;
     }
+
+    // Flushes the records still buffered in the trace ring before the file is closed
+    if constexpr (IsTraceLevelEnabled(TraceLevel::Instructions))
+        InstructionTracer::Instance().Stop();
 }
 
 void LaunchEmulator(ApplicationConfiguration configuration)
@@ -0,0 +1,18 @@
+$(info -------------------------------)
+$(info [BUILD::GBX] Entering directory '$(CURDIR)')
+$(info -------------------------------)
+CC = clang++
+
+LDFLAGS = $(LDCOVERAGE_FLAGS) -pthread
+CPPFLAGS = $(CCCOVERAGE_FLAGS) $(GLOBAL_CPP_FLAGS)
+
+INCLUDE = -I$(INCLUDE_CORE_TOP) -I$(INCLUDE_COMMONS_TOP)
+		  
+DEP_FILES = $(BUILD_TEMP)/gbxtrace.d
+
+TARGET_SOURCE = gbxtrace.cc
+TARGET = $(TRACE_DECODER)
+
+-include $(DEP_FILES)
+$(TARGET): $(TARGET_SOURCE) $(CORE_LIB) $(COMMONS_LIB)
+	$(CC) -MMD -MT"$@" -MF"$(DEP_FILES)" $(INCLUDE) $(TARGET_SOURCE) $(CPPFLAGS) -o $(TARGET) $(CORE_LIB) $(COMMONS_LIB) $(LDFLAGS)
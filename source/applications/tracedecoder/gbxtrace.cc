@@ -0,0 +1,73 @@
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "ArgumentsParser.h"
+#include "GBXCommonsExceptions.h"
+#include "GBXCoreExceptions.h"
+#include "InstructionTrace.h"
+
+using namespace std;
+using namespace gbxcore;
+using namespace gbxcommons;
+
+struct ApplicationConfiguration
+{
+    string TraceName;
+};
+
+ApplicationConfiguration ParseCommandLine(int argc, char** argv)
+{
+    ApplicationConfiguration configuration{};
+    auto parser = make_shared<ArgumentsParser>("gbxtrace -t <trace file>");
+    parser->RegisterOption("-t", "--trace", "Binary instruction trace file to decode", OptionType::Pair, OptionRequirement::Required);
+
+    try
+    {
+        parser->Parse(argv, argc);
+
+        if (parser->HasBeenFound("-h"))
+        {
+            cout << parser->Help() << '\n';
+            exit(0);
+        }
+
+        configuration.TraceName = parser->RetrieveOption("-t").Value.value();
+        return configuration;
+    }
+    catch(const GBXCommonsException& e)
+    {
+        cout << e.what() << '\n';
+        cout << parser->Help() << '\n';
+        exit(2);
+    }
+}
+
+void DecodeTrace(ApplicationConfiguration configuration)
+{
+    TraceFileReader reader(configuration.TraceName);
+
+    cout << "cycle thread pc prefix opcode" << '\n';
+    for (auto& record : reader.ReadAll())
+    {
+        cout << dec << record.Cycle << ' ' << record.Thread << ' ' 
+             << hex << setfill('0') << setw(4) << record.Address << ' ' 
+             << setw(2) << static_cast<size_t>(record.PreOpcode) << ' ' 
+             << setw(2) << static_cast<size_t>(record.Opcode) << '\n';
+    }
+}
+
+int main (int argc, char** argv)
+{
+    auto configuration = ParseCommandLine(argc, argv);
+
+    try
+    {
+        DecodeTrace(configuration);
+    }
+    catch (const GBXCoreException& e)
+    {
+        cerr << e.what() << '\n';
+        return 1;
+    }
+}
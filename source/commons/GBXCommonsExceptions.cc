@@ -17,6 +17,14 @@ FileLoaderException::FileLoaderException(const std::string& message)
     : GBXCommonsException(message)
 {}
 
+MappedFileException::MappedFileException(const std::string& message)
+    : GBXCommonsException(message)
+{}
+
+SaveFileException::SaveFileException(const std::string& message)
+    : GBXCommonsException(message)
+{}
+
 const char* GBXCommonsException::what() const noexcept
 {
     return _message.c_str();
@@ -0,0 +1,111 @@
+#include "MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace gbxcommons
+{
+
+MappedFile::MappedFile(string fileName)
+    : _fileName(fileName)
+{}
+
+MappedFile::~MappedFile()
+{
+    Unmap();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : _fileName(std::move(other._fileName))
+    , _fileSize(other._fileSize)
+    , _mapping(other._mapping)
+{
+    other._fileSize = 0;
+    other._mapping = nullptr;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unmap();
+        _fileName = std::move(other._fileName);
+        _fileSize = other._fileSize;
+        _mapping = other._mapping;
+        other._fileSize = 0;
+        other._mapping = nullptr;
+    }
+
+    return *this;
+}
+
+string MappedFile::FileName()
+{
+    return _fileName;
+}
+
+void MappedFile::Map()
+{
+    Unmap();
+
+    auto descriptor = open(_fileName.c_str(), O_RDONLY);
+    struct stat fileStatus{};
+
+    if (descriptor < 0 || fstat(descriptor, &fileStatus) < 0 || fileStatus.st_size == 0)
+    {
+        if (descriptor >= 0)
+            close(descriptor);
+
+        stringstream ss;
+        ss << "Unable to map file '" << _fileName << "'";
+        throw MappedFileException(ss.str());
+    }
+
+    auto mapping = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+    // The mapping keeps its own reference to the file
+    close(descriptor);
+
+    if (mapping == MAP_FAILED)
+    {
+        stringstream ss;
+        ss << "Unable to map file '" << _fileName << "'";
+        throw MappedFileException(ss.str());
+    }
+
+    _mapping = mapping;
+    _fileSize = static_cast<size_t>(fileStatus.st_size);
+}
+
+bool MappedFile::IsMapped()
+{
+    return _mapping != nullptr;
+}
+
+const uint8_t* MappedFile::Data()
+{
+    if (_mapping == nullptr)
+        throw MappedFileException("File has not yet been mapped");
+
+    return static_cast<const uint8_t*>(_mapping);
+}
+
+size_t MappedFile::Size()
+{
+    return _fileSize;
+}
+
+void MappedFile::Unmap()
+{
+    if (_mapping != nullptr)
+        munmap(_mapping, _fileSize);
+
+    _mapping = nullptr;
+    _fileSize = 0;
+}
+
+}
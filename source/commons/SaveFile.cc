@@ -0,0 +1,167 @@
+#include "SaveFile.h"
+
+#include <bit>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace gbxcommons
+{
+
+// Existing files may carry trailing data (e.g. clock state) past the RAM image, which is left untouched
+SaveFile::SaveFile(string fileName, size_t size)
+    : _fileName(fileName)
+    , _size(size)
+    , _dirtyBlocks((size + SaveFileBlockSize * 64 - 1) / (SaveFileBlockSize * 64))
+{
+    auto descriptor = open(_fileName.c_str(), O_RDWR | O_CREAT, 0644);
+    struct stat fileStatus{};
+
+    if (descriptor < 0 || fstat(descriptor, &fileStatus) < 0 || size == 0 ||
+        (static_cast<size_t>(fileStatus.st_size) < size && ftruncate(descriptor, static_cast<off_t>(size)) < 0))
+    {
+        if (descriptor >= 0)
+            close(descriptor);
+
+        stringstream ss;
+        ss << "Unable to map save file '" << _fileName << "'";
+        throw SaveFileException(ss.str());
+    }
+
+    auto mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+
+    if (mapping == MAP_FAILED)
+    {
+        stringstream ss;
+        ss << "Unable to map save file '" << _fileName << "'";
+        throw SaveFileException(ss.str());
+    }
+
+    _mapping = static_cast<uint8_t*>(mapping);
+}
+
+SaveFile::~SaveFile()
+{
+    StopFlushing();
+    Flush();
+    munmap(_mapping, _size);
+}
+
+string SaveFile::FileName()
+{
+    return _fileName;
+}
+
+uint8_t* SaveFile::Data()
+{
+    return _mapping;
+}
+
+size_t SaveFile::Size()
+{
+    return _size;
+}
+
+void SaveFile::MarkDirty(size_t offset)
+{
+    auto block = offset / SaveFileBlockSize;
+    _dirtyBlocks[block / 64].fetch_or(1llu << (block % 64), memory_order_release);
+}
+
+size_t SaveFile::DirtyBlockCount()
+{
+    auto count = 0llu;
+
+    for (auto& blocks : _dirtyBlocks)
+        count += static_cast<size_t>(popcount(blocks.load(memory_order_acquire)));
+
+    return count;
+}
+
+// Runs of consecutive dirty blocks are synced together. Blocks dirtied while flushing are picked up by the next flush.
+void SaveFile::Flush()
+{
+    auto runBegin = 0llu;
+    auto runLength = 0llu;
+
+    for (auto word = 0llu; word < _dirtyBlocks.size(); ++word)
+    {
+        auto blocks = _dirtyBlocks[word].exchange(0, memory_order_acquire);
+
+        if (blocks == 0 && runLength == 0)
+            continue;
+
+        for (auto bit = 0llu; bit < 64; ++bit)
+        {
+            if (blocks & (1llu << bit))
+            {
+                if (runLength++ == 0)
+                    runBegin = word * 64 + bit;
+            }
+            else if (runLength != 0)
+            {
+                SyncBlocks(runBegin, runLength);
+                runLength = 0;
+            }
+        }
+    }
+
+    if (runLength != 0)
+        SyncBlocks(runBegin, runLength);
+}
+
+void SaveFile::StartFlushing(chrono::milliseconds interval)
+{
+    if (_flushing.exchange(true))
+        return;
+
+    _interval = interval;
+    _flusher = make_unique<thread>([&]() { this->RunFlusher(); });
+}
+
+void SaveFile::StopFlushing()
+{
+    if (!_flushing.exchange(false))
+        return;
+
+    {
+        lock_guard<mutex> guard(_wakeUpMutex);
+        _wakeUp.notify_all();
+    }
+
+    _flusher->join();
+    _flusher.reset();
+}
+
+bool SaveFile::IsFlushing()
+{
+    return _flushing.load();
+}
+
+inline void SaveFile::RunFlusher()
+{
+    unique_lock<mutex> lock(_wakeUpMutex);
+
+    while (_flushing.load())
+    {
+        _wakeUp.wait_for(lock, _interval, [&]() { return !_flushing.load(); });
+        Flush();
+    }
+}
+
+// msync works on whole pages, so the run is widened to the pages containing it
+inline void SaveFile::SyncBlocks(size_t firstBlock, size_t blockCount)
+{
+    static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto begin = firstBlock * SaveFileBlockSize / pageSize * pageSize;
+    auto end = min(_size, (firstBlock + blockCount) * SaveFileBlockSize);
+
+    msync(_mapping + begin, end - begin, MS_SYNC);
+}
+
+}
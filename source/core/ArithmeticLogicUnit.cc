@@ -26,24 +26,45 @@ void ArithmeticLogicUnit::InitializeRegisters()
 
 void ArithmeticLogicUnit::Decode()
 {
-    try
+    auto opcode = _registers->Read(Register::IR);
+    auto complement = _registers->Read(Register::PIR);
+    auto preOpcode = IsSuffixedInstruction(complement)? make_optional<uint8_t>(complement) : nullopt;
+
+    if constexpr (IsTraceLevelEnabled(TraceLevel::Instructions))
+        TraceInstruction(static_cast<uint16_t>(_registers->ReadPair(Register::PC) - (preOpcode.has_value()? 2 : 1)), preOpcode.value_or(0x00), opcode);
+
+    if (_cachedInstruction != nullptr)
     {
-        auto opcode = _registers->Read(Register::IR);
-        auto complement = _registers->Read(Register::PIR);
-        auto preOpcode = IsSuffixedInstruction(complement)? make_optional<uint8_t>(complement) : nullopt;
-        _currentInstruction = _decoder.DecodeOpcode(opcode, preOpcode);
-        cout << hex << "PC: " << _registers->ReadPair(Register::PC) << " : " << static_cast<size_t>(preOpcode.value_or(0x00)) << " " << static_cast<size_t>(opcode) << '\n';
-        _currentInstruction->Decode(opcode, preOpcode, _instructionData);
-        ResolveMemoryAccessSignals();
+        SelectPredecodedInstruction(_cachedInstruction->Predecoded);
+        _cachedInstruction = nullptr;
     }
-    catch (const InstructionException&)
+    else
     {
-        // Nothing to do
+        _currentInstruction = _decoder.DecodeOpcode(opcode, preOpcode);
+        _currentInstruction->Decode(opcode, preOpcode, _instructionData);
+        _currentAddressingMode = ResolveAddressingModeTraits();
+        CacheDecodedInstruction(opcode, complement);
     }
+
+    ResolveMemoryAccessSignals();
 }
 
 void ArithmeticLogicUnit::AcquireInstruction(interfaces::MemoryControllerInterface* memoryController)
 {
+    ObserveMemoryController(memoryController);
+
+    auto address = _registers->ReadPair(Register::PC);
+    auto mode = memoryController->SecurityLevel();
+
+    if (_cachedInstruction = _decodeCache.Lookup(mode, address); 
+        _cachedInstruction != nullptr)
+    {
+        _registers->Write(Register::PIR, _cachedInstruction->Predecoded.PreOpcode);
+        _registers->Write(Register::IR, _cachedInstruction->Predecoded.Opcode);
+        _registers->WritePair(Register::PC, address + _cachedInstruction->Predecoded.Length);
+        return;
+    }
+
     auto instruction = ReadAtRegister(Register::PC, memoryController);
     IncrementPC();
 
@@ -54,12 +75,112 @@ void ArithmeticLogicUnit::AcquireInstruction(interfaces::MemoryControllerInterfa
 
         _registers->Write(Register::PIR, instruction);
         _registers->Write(Register::IR, secondInstruction);
+        _fetchedInstruction = {true, mode, address, 2, instruction, secondInstruction};
     }
     else 
     {
         _registers->Write(Register::PIR, 0x00);
         _registers->Write(Register::IR, instruction);
+        _fetchedInstruction = {true, mode, address, 1, 0x00, instruction};
+    }
+}
+
+PredecodedInstruction ArithmeticLogicUnit::PredecodeInstruction(interfaces::MemoryControllerInterface* memoryController, uint16_t address)
+{
+    auto length = static_cast<uint8_t>(1);
+    auto opcode = memoryController->ReadByte(address);
+    auto preOpcode = optional<uint8_t>(nullopt);
+
+    if (IsSuffixedInstruction(opcode))
+    {
+        preOpcode = opcode;
+        opcode = memoryController->ReadByte(static_cast<uint16_t>(address + length++));
     }
+
+    auto instruction = _decoder.DecodeOpcode(opcode, preOpcode);
+    auto decodedInstruction = _instructionData;
+    instruction->Decode(opcode, preOpcode, decodedInstruction);
+
+    auto traits = AddressingModeTemplate::Of(decodedInstruction.AddressingMode);
+    if (traits == nullptr)
+        throw ArithmeticLogicUnitException("invalid addressing mode");
+
+    if (traits->acquireOperand1 && traits->acquireOperand1FromPc)
+        decodedInstruction.MemoryOperand1 = memoryController->ReadByte(static_cast<uint16_t>(address + length++));
+
+    if (traits->acquireOperand2 && traits->acquireOperand2FromPc)
+        decodedInstruction.MemoryOperand2 = memoryController->ReadByte(static_cast<uint16_t>(address + length++));
+
+    return 
+    {
+        .PreOpcode = preOpcode.value_or(0x00),
+        .Opcode = opcode,
+        .Length = length,
+        .Instruction = instruction,
+        .Template = decodedInstruction,
+        .AddressingModeTraits = traits
+    };
+}
+
+void ArithmeticLogicUnit::LoadPredecodedInstruction(const PredecodedInstruction& predecodedInstruction)
+{
+    auto programCounter = _registers->ReadPair(Register::PC);
+
+    if constexpr (IsTraceLevelEnabled(TraceLevel::Instructions))
+        TraceInstruction(programCounter, predecodedInstruction.PreOpcode, predecodedInstruction.Opcode);
+
+    _registers->Write(Register::PIR, predecodedInstruction.PreOpcode);
+    _registers->Write(Register::IR, predecodedInstruction.Opcode);
+    _registers->WritePair(Register::PC, programCounter + predecodedInstruction.Length);
+
+    SelectPredecodedInstruction(predecodedInstruction);
+    ResolveMemoryAccessSignals();
+}
+
+inline void ArithmeticLogicUnit::SelectPredecodedInstruction(const PredecodedInstruction& predecodedInstruction)
+{
+    _currentInstruction = predecodedInstruction.Instruction;
+    _instructionData = predecodedInstruction.Template;
+    _currentAddressingMode = predecodedInstruction.AddressingModeTraits;
+}
+
+inline void ArithmeticLogicUnit::ObserveMemoryController(interfaces::MemoryControllerInterface* memoryController)
+{
+    if (_observedMemoryController == memoryController)
+        return;
+
+    if (_observedMemoryController != nullptr)
+        _observedMemoryController->UnregisterMemoryObserver(&_decodeCache);
+
+    _decodeCache.Flush();
+    memoryController->RegisterMemoryObserver(&_decodeCache);
+    _observedMemoryController = memoryController;
+}
+
+inline void ArithmeticLogicUnit::CacheDecodedInstruction(uint8_t opcode, uint8_t preOpcode)
+{
+    // Only instructions fetched from memory (as opposed to written straight into IR/PIR) are cached
+    if (!_fetchedInstruction.Pending || _fetchedInstruction.Opcode != opcode || _fetchedInstruction.PreOpcode != preOpcode)
+        return;
+
+    auto& entry = _decodeCache.Allocate(_fetchedInstruction.Mode, _fetchedInstruction.Address);
+    entry.Predecoded = 
+    {
+        .PreOpcode = preOpcode,
+        .Opcode = opcode,
+        .Length = _fetchedInstruction.Length,
+        .Instruction = _currentInstruction,
+        .Template = _instructionData,
+        .AddressingModeTraits = _currentAddressingMode
+    };
+
+    _fetchedInstruction.Pending = false;
+}
+
+inline void ArithmeticLogicUnit::TraceInstruction(uint16_t address, uint8_t preOpcode, uint8_t opcode)
+{
+    if (!_tracingSuppressed)
+        InstructionTracer::Instance().Record({_cycles, address, preOpcode, opcode, 0});
 }
 
 inline bool ArithmeticLogicUnit::IsSuffixedInstruction(uint8_t instruction)
@@ -77,52 +198,49 @@ void ArithmeticLogicUnit::Execute()
     if (_currentInstruction == nullptr)
         throw InstructionException("tried to execute an and e coded instruction");
 
-    _executionAborted = false;
-
-    if (dynamic_cast<ConditionalInstructionInterface*>(_currentInstruction) != nullptr)
-        _executionAborted = dynamic_cast<ConditionalInstructionInterface*>(_currentInstruction)->ConditionallyExecute(_registers, _instructionData);     
-    else
-        dynamic_cast<InstructionInterface*>(_currentInstruction)->Execute(_registers, _instructionData);     
+    _executionAborted = _currentInstruction->Run(_registers, _instructionData) == ExecutionOutcome::Aborted;
 
     ResolveExecutionSignals();
+    AccountInstructionCycles();
 }
 
-AddressingModeFormat* ArithmeticLogicUnit::AcquireAddressingModeTraits()
+inline void ArithmeticLogicUnit::AccountInstructionCycles()
 {
-    switch (_instructionData.AddressingMode)
-    {
-        case AddressingMode::Register: _currentAddressingMode = &AddressingModeTemplate::RegisterAddressingMode; break;
-        case AddressingMode::Immediate: _currentAddressingMode = &AddressingModeTemplate::ImmediateAddressingMode; break;
-        case AddressingMode::SingleImmediatePair: _currentAddressingMode = &AddressingModeTemplate::SingleImmediatePairAddressingMode; break;
-        case AddressingMode::RegisterIndexedSource: _currentAddressingMode = &AddressingModeTemplate::RegisterIndexedSourceAddressingMode; break;
-        case AddressingMode::RegisterIndexedDestination: _currentAddressingMode = &AddressingModeTemplate::RegisterIndexedDestinationAddressingMode; break;
-        case AddressingMode::RegisterIndirectSource: _currentAddressingMode = &AddressingModeTemplate::RegisterIndirectSourceAddressingMode; break;
-        case AddressingMode::RegisterIndirectDestination: _currentAddressingMode = &AddressingModeTemplate::RegisterIndirectDestinationAddressingMode; break;
-        case AddressingMode::RegisterIndirectSourceAndDestination: _currentAddressingMode = &AddressingModeTemplate::RegisterIndirectSourceAndDestinationAddressingMode; break;
-        case AddressingMode::ExtendedSource: _currentAddressingMode = &AddressingModeTemplate::RegisterExtendedSourceAddressingMode; break;
-        case AddressingMode::ExtendedDestination: _currentAddressingMode = &AddressingModeTemplate::RegisterExtendedDestinationAddressingMode; break;
-        case AddressingMode::ImmediateRegisterIndirect: _currentAddressingMode = &AddressingModeTemplate::ImmediateRegisterIndirectAddressingMode; break;
-        case AddressingMode::RegisterIndirectSourceIncrement: _currentAddressingMode = &AddressingModeTemplate::ImmediateRegisterIndirectSourceIncrementAddressingMode; break;
-        case AddressingMode::RegisterIndirectSourceDecrement: _currentAddressingMode = &AddressingModeTemplate::ImmediateRegisterIndirectSourceDecrementAddressingMode; break;
-        case AddressingMode::RegisterIndirectDestinationIncrement: _currentAddressingMode = &AddressingModeTemplate::ImmediateRegisterIndirectDestinationIncrementAddressingMode; break;
-        case AddressingMode::RegisterIndirectDestinationDecrement: _currentAddressingMode = &AddressingModeTemplate::ImmediateRegisterIndirectDestinationDecrementAddressingMode; break;
-        case AddressingMode::RegisterImplicitSource: _currentAddressingMode = &AddressingModeTemplate::ImplicitRegisterSourceAddressingMode; break;
-        case AddressingMode::RegisterImplicitDestination: _currentAddressingMode = &AddressingModeTemplate::ImplicitRegisterDestinationAddressingMode; break;
-        case AddressingMode::ImmediateImplicitSource: _currentAddressingMode = &AddressingModeTemplate::ImplicitImmediateSourceAddressingMode; break;
-        case AddressingMode::ImmediateImplicitDestination: _currentAddressingMode = &AddressingModeTemplate::ImplicitImmediateDestinationAddressingMode; break;
-        case AddressingMode::ImmediatePair: _currentAddressingMode = &AddressingModeTemplate::ImmediatePairAddressingMode; break;
-        case AddressingMode::RegisterPair: _currentAddressingMode = &AddressingModeTemplate::RegisterPairAddressingMode; break;
-        case AddressingMode::RegisterIndirectDestinationPair: _currentAddressingMode = &AddressingModeTemplate::RegisterIndirectDestinationPair; break;
-        case AddressingMode::RegisterIndirectSourcePair: _currentAddressingMode = &AddressingModeTemplate::RegisterIndirectSourcePair; break;
-        case AddressingMode::ExtendedDestinationPair: _currentAddressingMode = &AddressingModeTemplate::ExtendedDestinationPair; break;
-        case AddressingMode::SubRoutineCall: _currentAddressingMode = &AddressingModeTemplate::SubRoutineCallMode; break;
-        default:
-            throw ArithmeticLogicUnitException("invalid addressing mode");
-    }
+    auto cycles = InstructionCycleCosts[static_cast<size_t>(_instructionData.Opcode)][static_cast<size_t>(_instructionData.AddressingMode)];
+
+    _cycles += _executionAborted? cycles.NotTaken : cycles.Taken;
+    if (_registers->Read(Register::PIR) != 0x00)
+        _cycles += PrefixCycles;
+
+    // Unconditional rets are decoded without a condition (0xFF)
+    if (_instructionData.Opcode == OpcodeType::ret && _instructionData.InstructionExtraOperand != 0xFF && !_executionAborted)
+        _cycles += ConditionalReturnCycles;
+}
 
+const AddressingModeFormat* ArithmeticLogicUnit::AcquireAddressingModeTraits()
+{
     return _currentAddressingMode;
 }
 
+AddressingMode ArithmeticLogicUnit::AcquireAddressingMode()
+{
+    return _instructionData.AddressingMode;
+}
+
+uint16_t ArithmeticLogicUnit::AcquireProgramCounter()
+{
+    return _registers->ReadPair(Register::PC);
+}
+
+inline const AddressingModeFormat* ArithmeticLogicUnit::ResolveAddressingModeTraits()
+{
+    if (auto traits = AddressingModeTemplate::Of(_instructionData.AddressingMode);
+        traits != nullptr)
+        return traits;
+
+    throw ArithmeticLogicUnitException("invalid addressing mode");
+}
+
 void ArithmeticLogicUnit::AcquireOperand1AtPC(interfaces::MemoryControllerInterface* memoryController)
 {
     _instructionData.MemoryOperand1 = ReadAtRegister(Register::PC, memoryController);
@@ -131,7 +249,7 @@ void ArithmeticLogicUnit::AcquireOperand1AtPC(interfaces::MemoryControllerInterf
 
 void ArithmeticLogicUnit::AcquireOperand1AtRegister(interfaces::MemoryControllerInterface* memoryController)
 {
-    _instructionData.MemoryOperand1 = ReadAtRegister(_instructionData.SourceRegister, memoryController);
+    _instructionData.MemoryOperand1 = ReadOperandAt(_registers->ReadPair(_instructionData.SourceRegister), memoryController);
 
     if (_currentAddressingMode->incrementSource)
         IncrementRegisterPair(_instructionData.SourceRegister);
@@ -142,7 +260,7 @@ void ArithmeticLogicUnit::AcquireOperand1AtRegister(interfaces::MemoryController
 void ArithmeticLogicUnit::AcquireOperand1Implicitly(interfaces::MemoryControllerInterface* memoryController)
 {
     auto operandLocation = static_cast<uint16_t>(0xFF << 8 | _registers->Read(_instructionData.SourceRegister));
-    _instructionData.MemoryOperand1 = get<uint8_t>(memoryController->Read(operandLocation, MemoryAccessType::Byte));
+    _instructionData.MemoryOperand1 = ReadOperandAt(operandLocation, memoryController);
 }
 
 void ArithmeticLogicUnit::AcquireOperand2AtPC(interfaces::MemoryControllerInterface* memoryContorller)
@@ -154,18 +272,18 @@ void ArithmeticLogicUnit::AcquireOperand2AtPC(interfaces::MemoryControllerInterf
 void ArithmeticLogicUnit::AcquireOperand2AtComposedAddress(interfaces::MemoryControllerInterface* memoryController)
 {
     auto operandLocation = static_cast<uint16_t>(static_cast<int8_t>(_instructionData.MemoryOperand1) + _registers->ReadPair(_instructionData.SourceRegister));
-    _instructionData.MemoryOperand2 = get<uint8_t>(memoryController->Read(operandLocation, MemoryAccessType::Byte));
+    _instructionData.MemoryOperand2 = ReadOperandAt(operandLocation, memoryController);
 }
 
 void ArithmeticLogicUnit::AcquireOperand2Implicitly([[maybe_unused]] interfaces::MemoryControllerInterface* memoryController)
 {
     auto operandLocation = static_cast<uint16_t>(0xFF << 8 | _instructionData.MemoryOperand1);
-    _instructionData.MemoryOperand2 = get<uint8_t>(memoryController->Read(operandLocation, MemoryAccessType::Byte));
+    _instructionData.MemoryOperand2 = ReadOperandAt(operandLocation, memoryController);
 }
 
 void ArithmeticLogicUnit::AcquireOperand2Directly(interfaces::MemoryControllerInterface* memoryController)
 {
-    _instructionData.MemoryOperand2 = ReadAtRegister(_instructionData.SourceRegister, memoryController);
+    _instructionData.MemoryOperand2 = ReadOperandAt(_registers->ReadPair(_instructionData.SourceRegister), memoryController);
 
     if (_currentAddressingMode->incrementSourceOperand2)
         IncrementRegisterPair(_instructionData.SourceRegister);
@@ -174,21 +292,21 @@ void ArithmeticLogicUnit::AcquireOperand2Directly(interfaces::MemoryControllerIn
 void ArithmeticLogicUnit::AcquireOperand3(interfaces::MemoryControllerInterface* memoryController)
 {
     auto operandLocation = static_cast<uint16_t>(_instructionData.MemoryOperand1 | _instructionData.MemoryOperand2 << 8);
-    _instructionData.MemoryOperand3 = get<uint8_t>(memoryController->Read(operandLocation, MemoryAccessType::Byte));
+    _instructionData.MemoryOperand3 = ReadOperandAt(operandLocation, memoryController);
 }
 
 void ArithmeticLogicUnit::WriteBackAtOperandAddress(interfaces::MemoryControllerInterface* memoryController)
 {
     auto resultContent = _instructionData.MemoryResult1;
     auto resultAddress = static_cast<uint16_t>(static_cast<int8_t>(_instructionData.MemoryOperand1) + _registers->ReadPair(_instructionData.DestinationRegister));
-    memoryController->Write(static_cast<uint8_t>(resultContent), resultAddress);
+    memoryController->WriteByte(static_cast<uint8_t>(resultContent), resultAddress);
 }
 
 void ArithmeticLogicUnit::WriteBackAtRegisterAddress(interfaces::MemoryControllerInterface* memoryController)
 {
     auto resultContent = _instructionData.MemoryResult1;
     auto resultAddress = _registers->ReadPair(_instructionData.DestinationRegister);
-    memoryController->Write(static_cast<uint8_t>(resultContent), resultAddress);
+    memoryController->WriteByte(static_cast<uint8_t>(resultContent), resultAddress);
 
      if (_currentAddressingMode->incrementDestination)
         IncrementRegisterPair(_instructionData.DestinationRegister);
@@ -200,14 +318,14 @@ void ArithmeticLogicUnit::WriteBackAtComposedAddress([[maybe_unused]] interfaces
 {
     auto resultContent = _instructionData.MemoryResult1;
     auto resultAddress = static_cast<uint16_t>(_instructionData.MemoryOperand1 | _instructionData.MemoryOperand2 << 8);
-    memoryController->Write(static_cast<uint8_t>(resultContent), resultAddress);
+    memoryController->WriteByte(static_cast<uint8_t>(resultContent), resultAddress);
 }
 
 void ArithmeticLogicUnit::WriteBackAtImplicitRegisterAddress(interfaces::MemoryControllerInterface* memoryController)
 {
     auto resultContent = _instructionData.MemoryResult1;
     auto resultAddress = static_cast<uint16_t>(0xFF << 8 | _registers->Read(_instructionData.DestinationRegister));
-    memoryController->Write(static_cast<uint8_t>(resultContent), resultAddress);
+    memoryController->WriteByte(static_cast<uint8_t>(resultContent), resultAddress);
 }
 
 void ArithmeticLogicUnit::WriteBackPairAtRegisterAddress(interfaces::MemoryControllerInterface* memoryController)
@@ -215,8 +333,8 @@ void ArithmeticLogicUnit::WriteBackPairAtRegisterAddress(interfaces::MemoryContr
     auto operandMsb = _instructionData.MemoryResult1;
     auto operandLsb = _instructionData.MemoryResult2;
     auto stackPointer = _registers->ReadPair(Register::SP);
-    memoryController->Write(static_cast<uint8_t>(operandMsb), stackPointer - 1);
-    memoryController->Write(static_cast<uint8_t>(operandLsb), stackPointer - 2);
+    memoryController->WriteByte(static_cast<uint8_t>(operandMsb), stackPointer - 1);
+    memoryController->WriteByte(static_cast<uint8_t>(operandLsb), stackPointer - 2);
     _registers->WritePair(Register::SP, stackPointer - 2);
 }
 
@@ -225,8 +343,8 @@ void ArithmeticLogicUnit::WriteBackPairAtImmediareAddress(interfaces::MemoryCont
     auto operandLsb = _instructionData.MemoryResult1;
     auto operandMsb = _instructionData.MemoryResult2;
     auto address = static_cast<uint16_t>(_instructionData.MemoryOperand1 | (_instructionData.MemoryOperand2 << 0x08));
-    memoryController->Write(static_cast<uint8_t>(operandLsb), address);
-    memoryController->Write(static_cast<uint8_t>(operandMsb), address + 1);
+    memoryController->WriteByte(static_cast<uint8_t>(operandLsb), address);
+    memoryController->WriteByte(static_cast<uint8_t>(operandMsb), address + 1);
 }
 
 
@@ -234,13 +352,22 @@ void ArithmeticLogicUnit::WriteBackAtImplicitImmediateAddress(interfaces::Memory
 {
     auto resultContent = _registers->Read(_instructionData.SourceRegister);
     auto resultAddress = static_cast<uint16_t>(0xFF << 8 | _instructionData.MemoryOperand1);
-    memoryController->Write(static_cast<uint8_t>(resultContent), resultAddress);
+    memoryController->WriteByte(static_cast<uint8_t>(resultContent), resultAddress);
 }
 
 inline uint8_t ArithmeticLogicUnit::ReadAtRegister(Register reg, interfaces::MemoryControllerInterface* memoryController)
 {
     auto registerContent = _registers->ReadPair(reg);
-    return get<uint8_t>(memoryController->Read(registerContent, MemoryAccessType::Byte));
+    return memoryController->ReadByte(registerContent);
+}
+
+// LDU sources are read through the User view without switching the controller's security level
+inline uint8_t ArithmeticLogicUnit::ReadOperandAt(uint16_t address, interfaces::MemoryControllerInterface* memoryController)
+{
+    if (_userModeSourceOperandRequested) [[unlikely]]
+        return memoryController->ReadByteAs(PrivilegeMode::User, address);
+
+    return memoryController->ReadByte(address);
 }
 
 inline void ArithmeticLogicUnit::IncrementRegisterPair(Register reg)
@@ -271,11 +398,6 @@ bool ArithmeticLogicUnit::ClearInterruptStatusSignal()
     return _clearInterruptStatusSignal;
 }
 
-bool ArithmeticLogicUnit::HaltSignal()
-{
-    return _haltSignal;
-}
-
 bool ArithmeticLogicUnit::StopSignal()
 {
     return _stopSignal;
@@ -310,16 +432,18 @@ inline void ArithmeticLogicUnit::ResolveExecutionSignals()
         _interruptMasterEnable = false;
     else if (_instructionData.Opcode == OpcodeType::jpu && _executionAborted == false)
         _userModeRequested = true;
+    else if (_instructionData.Opcode == OpcodeType::illegal)
+        _illegalInstructionSignal = true;
 }
 
 inline void ArithmeticLogicUnit::ResolveMemoryAccessSignals()
 {
-    if (((_instructionData.Opcode == OpcodeType::ldu && _instructionData.AddressingMode == AddressingMode::RegisterIndirectSourcePair) ||
+    // Decoding runs before Execute resets the abort signal, which still belongs to the previous instruction
+    if ((_instructionData.Opcode == OpcodeType::ldu && _instructionData.AddressingMode == AddressingMode::RegisterIndirectSourcePair) ||
         (_instructionData.Opcode == OpcodeType::ldu && _instructionData.AddressingMode == AddressingMode::RegisterIndirectSource) ||
         (_instructionData.Opcode == OpcodeType::ldu && _instructionData.AddressingMode == AddressingMode::RegisterIndirectSourceAndDestination) ||
         (_instructionData.Opcode == OpcodeType::ldu && _instructionData.AddressingMode == AddressingMode::RegisterIndirectSourceIncrement) ||
-        (_instructionData.Opcode == OpcodeType::ldu && _instructionData.AddressingMode == AddressingMode::RegisterIndirectSourceDecrement)) &&
-        _executionAborted == false)
+        (_instructionData.Opcode == OpcodeType::ldu && _instructionData.AddressingMode == AddressingMode::RegisterIndirectSourceDecrement))
         _userModeSourceOperandRequested = true;
 }
 
@@ -328,6 +452,7 @@ inline void ArithmeticLogicUnit::ClearExecutionSignals()
     _clearInterruptStatusSignal = false;
     _haltSignal = false;
     _stopSignal = false;
+    _illegalInstructionSignal = false;
     _userModeRequested = false;
     _userModeSourceOperandRequested = false;
 }
@@ -0,0 +1,123 @@
+#include "BasicBlockCache.h"
+
+using namespace std;
+using namespace gbxcore::interfaces;
+
+namespace gbxcore
+{
+
+shared_ptr<BasicBlock> BasicBlockCache::Lookup(PrivilegeMode mode, uint16_t address)
+{
+    if (auto block = _blocks.find(KeyOf(mode, address)); block != end(_blocks))
+        return block->second;
+
+    return nullptr;
+}
+
+void BasicBlockCache::Insert(shared_ptr<BasicBlock> block)
+{
+    if (block->Instructions.size() == 0)
+        throw ControlUnitException("tried to cache an empty basic block");
+
+    for (auto page = block->Begin / PageSize; page <= block->End / PageSize; ++page)
+        _pages[page].push_back(block);
+
+    _blocks[KeyOf(block->Mode, block->Begin)] = block;
+}
+
+void BasicBlockCache::Flush()
+{
+    for (auto& [key, block] : _blocks)
+        block->Valid = false;
+
+    _blocks.clear();
+    _overwrites.clear();
+
+    for (auto& page : _pages)
+        page.clear();
+}
+
+size_t BasicBlockCache::Size()
+{
+    return _blocks.size();
+}
+
+size_t BasicBlockCache::Overwrites(PrivilegeMode mode, uint16_t address)
+{
+    if (auto overwrites = _overwrites.find(KeyOf(mode, address)); overwrites != end(_overwrites))
+        return overwrites->second;
+
+    return 0;
+}
+
+void BasicBlockCache::OnWrite(size_t address)
+{
+    auto& page = _pages[(address & 0xFFFF) / PageSize];
+
+    // Only blocks that actually cover the written byte are dropped, so data
+    // sharing a page with code does not force the code to be retranslated
+    for (auto block = begin(page); block != end(page);)
+    {
+        if (address >= (*block)->Begin && address <= (*block)->End)
+        {
+            if ((*block)->Valid)
+                ++_overwrites[KeyOf((*block)->Mode, (*block)->Begin)];
+
+            Invalidate(*block);
+            block = page.erase(block);
+        }
+        else if (!(*block)->Valid)
+            block = page.erase(block);
+        else
+            ++block;
+    }
+}
+
+void BasicBlockCache::OnBankSwitch(PrivilegeMode mode, AddressRange range, size_t)
+{
+    auto firstPage = range.Begin() / PageSize;
+    auto lastPage = min(range.End() / PageSize, PageCount - 1);
+
+    for (auto page = firstPage; page <= lastPage; ++page)
+    {
+        for (auto block = begin(_pages[page]); block != end(_pages[page]);)
+        {
+            if (SharesMode((*block)->Mode, mode) || !(*block)->Valid)
+            {
+                Invalidate(*block);
+                block = _pages[page].erase(block);
+            }
+            else
+                ++block;
+        }
+    }
+}
+
+// Resources registered for both modes are seen by blocks of either mode
+inline bool BasicBlockCache::SharesMode(PrivilegeMode blockMode, PrivilegeMode mode)
+{
+    return blockMode == mode || blockMode == PrivilegeMode::Both || mode == PrivilegeMode::Both;
+}
+
+void BasicBlockCache::OnInvalidate()
+{
+    Flush();
+}
+
+inline size_t BasicBlockCache::KeyOf(PrivilegeMode mode, uint16_t address)
+{
+    return static_cast<size_t>(mode) << 16 | address;
+}
+
+inline void BasicBlockCache::Invalidate(shared_ptr<BasicBlock>& block)
+{
+    if (!block->Valid)
+        return;
+
+    block->Valid = false;
+
+    if (auto cached = _blocks.find(KeyOf(block->Mode, block->Begin)); cached != end(_blocks) && cached->second == block)
+        _blocks.erase(cached);
+}
+
+}
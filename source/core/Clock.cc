@@ -36,6 +36,11 @@ void Clock::Tick(uint64_t ticks, uint64_t instructionExecutionTimInNanoseconds)
         while(chrono::high_resolution_clock::now() - start < sleepTime);
     }
 
+    Advance(ticks);
+}
+
+void Clock::Advance(uint64_t ticks)
+{
     _ticks += ticks;
 }
 
@@ -8,12 +8,13 @@ namespace gbxcore
 
 ControlUnit::ControlUnit()
     : _preOpcode(nullopt)
-    , _currentAddressingMode(nullptr)
+    , _executionPath(nullptr)
 {}
 
 void ControlUnit::Initialize(MemoryControllerInterface* memoryController, ArithmeticLogicUnitInterface* alu)
 {
     _memoryController = memoryController;
+    _instructionMemoryController = memoryController;
     _alu = alu;
 
     call_once(_flag, [&]() -> void { _alu->InitializeRegisters(); });
@@ -24,32 +25,67 @@ void ControlUnit::RunCycle()
     // 1 Fetch
     Fetch();
 
-    // 2 Decode Instruction
+    // 2 Decode Instruction (also selects the execution path of its addressing mode)
     Decode();
 
+    // 2.1 to 4 Acquire Operands, Execute and WriteBack
+    (this->*_executionPath)();
+}
+
+size_t ControlUnit::RunBounded(const ExecutionBounds&)
+{
+    RunCycle();
+    return 1;
+}
+
+constexpr AddressingModeFormat ControlUnit::TraitsOf(AddressingMode mode)
+{
+    if (auto traits = AddressingModeTemplate::Of(mode); traits != nullptr)
+        return *traits;
+
+    return AddressingModeTemplate::NoAddressingMode;
+}
+
+template<bool Predecoded, size_t ...Modes>
+constexpr array<ControlUnit::ExecutionPath, sizeof...(Modes)> ControlUnit::BuildExecutionPaths(index_sequence<Modes...>)
+{
+    return {&ControlUnit::RunExecutionPath<static_cast<AddressingMode>(Modes), Predecoded>...};
+}
+
+// Predecoded paths run instructions whose immediate operands were bound (and PC advanced) at translation time
+template<AddressingMode Mode, bool Predecoded>
+void ControlUnit::RunExecutionPath()
+{
+    constexpr auto traits = TraitsOf(Mode);
+
     // 2.1 Acquire Operand 1 or displacement
-    if (_currentAddressingMode->acquireOperand1)
-        AcquireOperand1();
+    if constexpr (traits.acquireOperand1)
+        AcquireOperand1<Mode, Predecoded>();
     
     // 2.2 Acquire Operand 2 or Operand from address + displacement or MSByte of 
-    if (_currentAddressingMode->acquireOperand2)
-        AcquireOperand2();
+    if constexpr (traits.acquireOperand2)
+        AcquireOperand2<Mode, Predecoded>();
 
     // 2.3 Acquire Operand 3 (extended source) 
-    if (_currentAddressingMode->acquireOperand3)
+    if constexpr (traits.acquireOperand3)
         AcquireOperand3();
 
     // 3 Execute
     Execute();
 
     // 4 WriteBack
-    if (_currentAddressingMode->writeBack && !IsExecutionAborted())
-        WriteBack();
+    if constexpr (traits.writeBack)
+    {
+        if (!IsExecutionAborted())
+            WriteBack<Mode>();
+    }
 }
 
+// Instructions are always fetched through the controller the unit was initialized with. Data accesses may be routed
+// elsewhere (e.g. through a journal), which would otherwise detach the ALU's decoded instruction cache on every swap
 inline void ControlUnit::Fetch()
 {
-    _alu->AcquireInstruction(_memoryController);
+    _alu->AcquireInstruction(_instructionMemoryController);
 }
 
 inline void ControlUnit::Decode()
@@ -58,70 +94,43 @@ inline void ControlUnit::Decode()
     AcquireAddressingMode();
 }
 
+template<AddressingMode Mode, bool Predecoded>
 inline void ControlUnit::AcquireOperand1()
 {
-    if (_currentAddressingMode->acquireOperand1FromPc)
-        ReadOperand1AtPC();
-    else
+    constexpr auto traits = TraitsOf(Mode);
+
+    if constexpr (traits.acquireOperand1FromPc)
     {
-        auto oldMode = SecurityLevel::System;
-        if (IsUserSourceOperandModeRequested())
-        {
-            oldMode = _memoryController->SecurityLevel();
-            _memoryController->SetSecurityLevel(SecurityLevel::User);            
-        }
-
-        if (_currentAddressingMode->acquireOperand1Directly)
-            ReadOperand1AtRegister();
-        else if (_currentAddressingMode->acquireOperand1Implicitly)
-            ReadOperand1Implicitly();
-
-        if (IsUserSourceOperandModeRequested())
-            _memoryController->SetSecurityLevel(oldMode);            
+        if constexpr (!Predecoded)
+            ReadOperand1AtPC();
     }
+    else if constexpr (traits.acquireOperand1Directly)
+        ReadOperand1AtRegister();
+    else if constexpr (traits.acquireOperand1Implicitly)
+        ReadOperand1Implicitly();
 }
 
+template<AddressingMode Mode, bool Predecoded>
 inline void ControlUnit::AcquireOperand2()
 {
-    if (_currentAddressingMode->acquireOperand2FromPc)
-        ReadOperand2AtPC();
-    else
-    { 
-        auto oldMode = SecurityLevel::System;
-        if (IsUserSourceOperandModeRequested())
-        {
-            oldMode = _memoryController->SecurityLevel();
-            _memoryController->SetSecurityLevel(SecurityLevel::User);            
-        }
-
-        if (IsUserSourceOperandModeRequested())
-            _memoryController->SetSecurityLevel(SecurityLevel::User);            
-
-        if (_currentAddressingMode->acquireOperand2AtComposedAddress)
-            ReadOperand2AtComposedAddress();
-        else if (_currentAddressingMode->acquireOperand2Implicitly)
-            ReadOperand2Implicitly();
-        else if (_currentAddressingMode->acquireOperand2Directly)
-            ReadOperand2Directly();
-
-        if (IsUserSourceOperandModeRequested())
-            _memoryController->SetSecurityLevel(oldMode);            
+    constexpr auto traits = TraitsOf(Mode);
+
+    if constexpr (traits.acquireOperand2FromPc)
+    {
+        if constexpr (!Predecoded)
+            ReadOperand2AtPC();
     }
+    else if constexpr (traits.acquireOperand2AtComposedAddress)
+        ReadOperand2AtComposedAddress();
+    else if constexpr (traits.acquireOperand2Implicitly)
+        ReadOperand2Implicitly();
+    else if constexpr (traits.acquireOperand2Directly)
+        ReadOperand2Directly();
 }
 
 inline void ControlUnit::AcquireOperand3()
 {
-    auto oldMode = SecurityLevel::System;
-    if (IsUserSourceOperandModeRequested())
-    {
-        oldMode = _memoryController->SecurityLevel();
-        _memoryController->SetSecurityLevel(SecurityLevel::User);            
-    }
-
     _alu->AcquireOperand3(_memoryController);
-
-    if (IsUserSourceOperandModeRequested())
-        _memoryController->SetSecurityLevel(oldMode);            
 }
 
 inline void ControlUnit::Execute()
@@ -129,9 +138,10 @@ inline void ControlUnit::Execute()
     ExecuteInstruction();
 }
 
+template<AddressingMode Mode>
 inline void ControlUnit::WriteBack()
 {
-    WriteBackResults();
+    WriteBackResults<Mode>();
 }
 
 inline void ControlUnit::InitializeRegisters()
@@ -146,7 +156,7 @@ inline void ControlUnit::DecodeInstruction()
 
 inline void ControlUnit::AcquireAddressingMode()
 {
-    _currentAddressingMode = _alu->AcquireAddressingModeTraits();
+    _executionPath = ExecutionPaths[static_cast<size_t>(_alu->AcquireAddressingMode())];
 }
 
 inline void ControlUnit::ReadOperand1AtPC()
@@ -192,21 +202,24 @@ inline void ControlUnit::ExecuteInstruction()
         _memoryController->SetSecurityLevel(SecurityLevel::User);
 }
 
+template<AddressingMode Mode>
 inline void ControlUnit::WriteBackResults()
 {
-    if (_currentAddressingMode->writeBackAtOperandAddress)
+    constexpr auto traits = TraitsOf(Mode);
+
+    if constexpr (traits.writeBackAtOperandAddress)
         WriteBackAtOperandAddress();
-    else if (_currentAddressingMode->writeBackAtRegisterAddress)
+    else if constexpr (traits.writeBackAtRegisterAddress)
         WriteBackAtRegisterAddress();
-    else if (_currentAddressingMode->writeBackAtComposedOperandAddress)
+    else if constexpr (traits.writeBackAtComposedOperandAddress)
         WriteBackAtComposedAddress();
-    else if (_currentAddressingMode->writeBackAtImplicitlyWithRegister)
+    else if constexpr (traits.writeBackAtImplicitlyWithRegister)
         WriteBackAtImplicitRegisterAddress();
-    else if (_currentAddressingMode->writeBackAtImplicitlyWithImmediateOperand)
+    else if constexpr (traits.writeBackAtImplicitlyWithImmediateOperand)
         WriteBackAtImplicitImmediateAddress();
-    else if (_currentAddressingMode->writeBackPairAtRegisterAddress)
+    else if constexpr (traits.writeBackPairAtRegisterAddress)
         WriteBackPairAtRegisterAddress();
-    else if (_currentAddressingMode->writeBackPairAtImmediateAddress)
+    else if constexpr (traits.writeBackPairAtImmediateAddress)
         WriteBackPairAtImmediateAddress();
 }
 
@@ -255,9 +268,10 @@ inline bool ControlUnit::IsUserModeRequested()
     return _alu->UserModeRequested();
 }
 
-inline bool ControlUnit::IsUserSourceOperandModeRequested()
-{
-    return _alu->UserModeSourceOperandRequested();
-}
+const array<ControlUnit::ExecutionPath, AddressingModeCount> ControlUnit::ExecutionPaths = 
+    ControlUnit::BuildExecutionPaths<false>(make_index_sequence<AddressingModeCount>{});
+
+const array<ControlUnit::ExecutionPath, AddressingModeCount> ControlUnit::PredecodedExecutionPaths = 
+    ControlUnit::BuildExecutionPaths<true>(make_index_sequence<AddressingModeCount>{});
 
 }
\ No newline at end of file
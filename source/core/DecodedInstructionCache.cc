@@ -0,0 +1,85 @@
+#include "DecodedInstructionCache.h"
+
+using namespace std;
+using namespace gbxcore::interfaces;
+
+namespace gbxcore
+{
+
+DecodedInstructionCacheEntry* DecodedInstructionCache::Lookup(PrivilegeMode mode, uint16_t address)
+{
+    auto& entry = _entries[address & (CacheSize - 1)];
+
+    if (entry.Valid && entry.Address == address && entry.Mode == mode && entry.Bank == BankAt(mode, address))
+        return &entry;
+
+    return nullptr;
+}
+
+DecodedInstructionCacheEntry& DecodedInstructionCache::Allocate(PrivilegeMode mode, uint16_t address)
+{
+    auto& entry = _entries[address & (CacheSize - 1)];
+
+    entry.Valid = true;
+    entry.Mode = mode;
+    entry.Bank = BankAt(mode, address);
+    entry.Address = address;
+
+    return entry;
+}
+
+void DecodedInstructionCache::Flush()
+{
+    for (auto& entry : _entries)
+        entry.Valid = false;
+}
+
+void DecodedInstructionCache::OnWrite(size_t address)
+{
+    // Cached entries cover the pre-opcode (if any) and the opcode, so a write
+    // may hit either the first or the second byte of an entry
+    InvalidateAt(address, 1);
+
+    if (address > 0)
+        InvalidateAt(address - 1, 2);
+}
+
+void DecodedInstructionCache::OnBankSwitch(PrivilegeMode mode, AddressRange range, size_t bank)
+{
+    // Entries are tagged with their bank, so the ones decoded from the previous
+    // bank simply stop matching (and become valid again once it is switched back)
+    for (auto& activeBank : _activeBanks)
+    {
+        if (activeBank.Mode == mode && activeBank.Begin == range.Begin() && activeBank.End == range.End())
+        {
+            activeBank.Bank = bank;
+            return;
+        }
+    }
+
+    _activeBanks.push_back({mode, range.Begin(), range.End(), bank});
+}
+
+void DecodedInstructionCache::OnInvalidate()
+{
+    Flush();
+}
+
+inline size_t DecodedInstructionCache::BankAt(PrivilegeMode mode, uint16_t address)
+{
+    for (auto& activeBank : _activeBanks)
+        if (activeBank.Mode == mode && address >= activeBank.Begin && address <= activeBank.End)
+            return activeBank.Bank;
+
+    return 0;
+}
+
+inline void DecodedInstructionCache::InvalidateAt(size_t address, uint8_t minimumLength)
+{
+    auto& entry = _entries[address & (CacheSize - 1)];
+
+    if (entry.Valid && entry.Address == address && entry.Predecoded.Length >= minimumLength)
+        entry.Valid = false;
+}
+
+}
\ No newline at end of file
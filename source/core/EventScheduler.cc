@@ -0,0 +1,61 @@
+#include "EventScheduler.h"
+
+using namespace std;
+
+namespace gbxcore
+{
+
+// Handles grow monotonically, so they also order events scheduled for the same cycle
+EventHandle EventScheduler::Schedule(uint64_t cycle, ScheduledEvent event)
+{
+    auto handle = _nextHandle++;
+
+    _events.push_back({.Cycle = cycle, .Handle = handle, .Event = std::move(event)});
+    push_heap(_events.begin(), _events.end(), FiresLater);
+    UpdateNextEventCycle();
+
+    return handle;
+}
+
+void EventScheduler::Cancel(EventHandle handle)
+{
+    auto event = find_if(_events.begin(), _events.end(), [handle](const PendingEvent& pending) { return pending.Handle == handle; });
+
+    if (event == _events.end())
+        return;
+
+    _events.erase(event);
+    make_heap(_events.begin(), _events.end(), FiresLater);
+    UpdateNextEventCycle();
+}
+
+// Events are popped before being fired, so callbacks are free to schedule (or cancel) other events
+void EventScheduler::RunDue(uint64_t cycle)
+{
+    while (!_events.empty() && _events.front().Cycle <= cycle)
+    {
+        pop_heap(_events.begin(), _events.end(), FiresLater);
+        auto due = std::move(_events.back());
+        _events.pop_back();
+        UpdateNextEventCycle();
+
+        due.Event(due.Cycle);
+    }
+}
+
+size_t EventScheduler::PendingEventCount() const
+{
+    return _events.size();
+}
+
+inline void EventScheduler::UpdateNextEventCycle()
+{
+    _nextEventCycle = _events.empty() ? NoPendingEvent : _events.front().Cycle;
+}
+
+inline bool EventScheduler::FiresLater(const PendingEvent& left, const PendingEvent& right)
+{
+    return left.Cycle != right.Cycle ? left.Cycle > right.Cycle : left.Handle > right.Handle;
+}
+
+}
@@ -45,6 +45,14 @@ VideoOutputException::VideoOutputException(const std::string& message)
     : GBXCoreException(message)
 {}
 
+ControlUnitException::ControlUnitException(const std::string& message)
+    : GBXCoreException(message)
+{}
+
+TraceException::TraceException(const std::string& message)
+    : GBXCoreException(message)
+{}
+
 const char* GBXCoreException::what() const noexcept
 {
     return _message.c_str();
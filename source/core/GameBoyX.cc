@@ -12,15 +12,16 @@ using namespace std;
 namespace gbxcore
 {
 
-GameBoyX::GameBoyX()
+GameBoyX::GameBoyX(ExecutionEngine engine, ExecutionValidation validation)
 {
-    auto controlUnit = make_unique<ControlUnit>();
     auto memoryController = make_unique<MemoryController>();
          _memoryControllerPtr = memoryController.get();
     
     auto registers = make_unique<RegisterBank>();
          _registersPtr = registers.get();
 
+    auto controlUnit = CreateControlUnit(engine, validation, registers.get());
+
     auto alu = make_unique<ArithmeticLogicUnit>();
     auto clock = make_unique<Clock>(GBCClockPeriod);
 
@@ -30,13 +31,16 @@ GameBoyX::GameBoyX()
 
     // DMGBC User Mode memory map
     auto userFixedROMBank = make_unique<ROM>(DMGBCROMBankSize);
-    auto userDynamicBank = make_unique<BankedROM>(DMGBCMaxDynamicROMSize, DMGBCROMBankSize); 
+    auto userDynamicBank = make_unique<BankedROM>(DMGBCMaxROMSize, DMGBCROMBankSize);
+         _userBankedROMPtr = userDynamicBank.get();
     auto userVideoRAM = make_unique<RAM>(DMGBCVideoRAMPhysicalSize);
     auto userVideoRAMPointer = userVideoRAM.get();
-    auto userExternalRAM = make_unique<RAM>(DMGBCExternalRAMPhysicalSize);
+    auto userExternalRAM = make_unique<BatteryBackedRAM>(DMGBCMaxExternalRAMSize, DMGBCExternalRAMPhysicalSize);
+         _userExternalRAMPtr = userExternalRAM.get();
     auto userWorkRAMBank0 = make_unique<RAM>(DMGBCSystemRAMBank0PhysicalSize);
     auto userWorkRAMBank1 = make_unique<RAM>(DMGBCSystemRAMBank1PhysicalSize);
     auto userMirrorRAM = make_unique<RAM>(DMGBCMirrorRAMPhysicalSize);
+    auto userOAM = make_unique<RAM>(DMGBCOAMPhysicalSize);
     auto userIORAM = make_unique<RAM>(DMGBCIORAMPhysicalSize);
     auto userHRAM = make_unique<RAM>(DMGBCHRAMPhysicalSize);
 
@@ -50,6 +54,7 @@ GameBoyX::GameBoyX()
     memoryController->RegisterMemoryResource(std::move(userWorkRAMBank0), AddressRange(DMGBCSystemRAMBank0InitialAddress, DMGBCSystemRAMBank0FinalAddress, RangeType::BeginInclusive), PrivilegeMode::User);
     memoryController->RegisterMemoryResource(std::move(userWorkRAMBank1), AddressRange(DMGBCSystemRAMBank1InitialAddress, DMGBCSystemRAMBank1FinalAddress, RangeType::BeginInclusive), PrivilegeMode::User);
     memoryController->RegisterMemoryResource(std::move(userMirrorRAM), AddressRange(DMGBCMirrorRAMInitialAddress, DMGBCMirrorRAMFinalAddress, RangeType::BeginInclusive), PrivilegeMode::User);
+    memoryController->RegisterMemoryResource(std::move(userOAM), AddressRange(DMGBCOAMInitialAddress, DMGBCOAMFinalAddress, RangeType::BeginInclusive), PrivilegeMode::User);
     memoryController->RegisterMemoryResource(std::move(userIORAM), AddressRange(DMGBCIORAMInitialAddress, DMGBCIORAMFinalAddress, RangeType::BeginInclusive), PrivilegeMode::User);
     memoryController->RegisterMemoryResource(std::move(userHRAM), AddressRange(DMGBCHRAMInitialAddress, DMGBCHRAMFinalAddress, RangeType::BeginInclusive), PrivilegeMode::User);
 
@@ -64,13 +69,57 @@ GameBoyX::GameBoyX()
     _videoController = make_unique<LCDVideoController>(videoOutputPointer);
     auto videoControllerPointer = _videoController.get();
     auto lcdControlRegister = make_unique<LCDControlRegister>(dynamic_cast<VideoControllerInterface*>(videoControllerPointer));
+    auto oamDMARegister = make_unique<OAMDMARegister>(memoryController.get(), [this]() { return _cpu.Cycles(); });
+    oamDMARegister->RegisterScheduler(&_cpu.Scheduler());
+    auto hdmaSourceHighRegister = make_unique<CGBHDMAAddressRegister>();
+    auto hdmaSourceLowRegister = make_unique<CGBHDMAAddressRegister>();
+    auto hdmaDestinationHighRegister = make_unique<CGBHDMAAddressRegister>();
+    auto hdmaDestinationLowRegister = make_unique<CGBHDMAAddressRegister>();
+    auto hdmaControlRegister = make_unique<CGBHDMAControlRegister>(memoryController.get(), [this](uint64_t cycles) { _cpu.Stall(cycles); });
+         _hdmaControlRegisterPtr = hdmaControlRegister.get();
+    hdmaControlRegister->RegisterAddressRegisters(hdmaSourceHighRegister.get(), hdmaSourceLowRegister.get(), hdmaDestinationHighRegister.get(), hdmaDestinationLowRegister.get());
 
     // Register LCD Registers
     memoryController->RegisterMemoryMappedRegister(std::move(lcdControlRegister), LCDControlRegisterAddress, PrivilegeMode::Both);
 
+    // Register DMA Registers
+    memoryController->RegisterMemoryMappedRegister(std::move(oamDMARegister), OAMDMARegisterAddress, PrivilegeMode::Both);
+    memoryController->RegisterMemoryMappedRegister(std::move(hdmaSourceHighRegister), CGBHDMASourceHighAddress, PrivilegeMode::Both);
+    memoryController->RegisterMemoryMappedRegister(std::move(hdmaSourceLowRegister), CGBHDMASourceLowAddress, PrivilegeMode::Both);
+    memoryController->RegisterMemoryMappedRegister(std::move(hdmaDestinationHighRegister), CGBHDMADestinationHighAddress, PrivilegeMode::Both);
+    memoryController->RegisterMemoryMappedRegister(std::move(hdmaDestinationLowRegister), CGBHDMADestinationLowAddress, PrivilegeMode::Both);
+    memoryController->RegisterMemoryMappedRegister(std::move(hdmaControlRegister), CGBHDMAControlAddress, PrivilegeMode::Both);
+
     // Initialize Z80X CPU 
     // ADD VideoController Here
     _cpu.Initialize(std::move(controlUnit), std::move(clock), std::move(alu), std::move(memoryController), std::move(registers), std::move(videoOutput));
+
+    ScheduleHBlank(0);
+}
+
+// HBlank starts DMGBCMachineCyclesToHBlank cycles into every visible scan line; each one reschedules the next
+void GameBoyX::ScheduleHBlank(uint64_t cycle)
+{
+    auto scanLine = cycle / DMGBCMachineCyclesPerScanLine + (cycle % DMGBCMachineCyclesPerScanLine >= DMGBCMachineCyclesToHBlank ? 1 : 0);
+
+    if (auto frameLine = scanLine % DMGBCScanLinesPerFrame; frameLine >= DMGBCVisibleScanLines)
+        scanLine += DMGBCScanLinesPerFrame - frameLine;
+
+    _cpu.Scheduler().Schedule(scanLine * DMGBCMachineCyclesPerScanLine + DMGBCMachineCyclesToHBlank, [this](uint64_t hblank)
+    {
+        _hdmaControlRegisterPtr->OnHBlank();
+        ScheduleHBlank(hblank);
+    });
+}
+
+unique_ptr<ControlUnit> GameBoyX::CreateControlUnit(ExecutionEngine engine, ExecutionValidation validation, RegisterBankInterface* registers)
+{
+    switch (engine)
+    {
+        case ExecutionEngine::ThreadedInterpreter: return make_unique<ThreadedControlUnit>();
+        case ExecutionEngine::Tiered: return make_unique<TieredControlUnit>(registers, validation);
+        default: return make_unique<ControlUnit>();
+    }
 }
 
 void GameBoyX::Run()
@@ -78,6 +127,50 @@ void GameBoyX::Run()
     _cpu.Run();
 }
 
+StopReason GameBoyX::RunFor(uint64_t cycles, CancellationCheck isCancelled)
+{
+    auto reason = _cpu.RunFor(cycles, isCancelled);
+    _cpu.Render();
+    return reason;
+}
+
+StopReason GameBoyX::RunInstructions(uint64_t instructions, CancellationCheck isCancelled)
+{
+    auto reason = _cpu.RunInstructions(instructions, isCancelled);
+    _cpu.Render();
+    return reason;
+}
+
+StopReason GameBoyX::RunFrame(CancellationCheck isCancelled)
+{
+    return RunFor(DMGBCMachineCyclesPerFrame - (_cpu.Cycles() % DMGBCMachineCyclesPerFrame), isCancelled);
+}
+
+void GameBoyX::SetBreakpoint(uint16_t address)
+{
+    _cpu.SetBreakpoint(address);
+}
+
+void GameBoyX::ClearBreakpoint(uint16_t address)
+{
+    _cpu.ClearBreakpoint(address);
+}
+
+const string& GameBoyX::LastError() const
+{
+    return _cpu.LastError();
+}
+
+uint64_t GameBoyX::Instructions() const
+{
+    return _cpu.Instructions();
+}
+
+uint64_t GameBoyX::Cycles() const
+{
+    return _cpu.Cycles();
+}
+
 variant<uint8_t, uint16_t> GameBoyX::ReadRegister(interfaces::Register reg)
 {
     if (RegisterBankInterface::IsPair(reg))
@@ -112,6 +205,18 @@ void GameBoyX::LoadGame(string gameROMName)
     }
 }
 
+// Cartridge RAM is backed by the save file in place: writes are synced to disk by a background flusher every
+// interval and once more when the emulator is destroyed or another game is loaded
+void GameBoyX::AttachSaveFile(string saveFileName, chrono::milliseconds flushInterval)
+{
+    if (_externalRAMSize == 0)
+        throw MemoryControllerException("Loaded game has no external RAM to save");
+
+    auto saveFile = make_unique<SaveFile>(saveFileName, _externalRAMSize);
+    saveFile->StartFlushing(flushInterval);
+    _userExternalRAMPtr->Attach(std::move(saveFile));
+}
+
 void GameBoyX::LoadBIOS(string BIOSROMName)
 {
     auto oldMode = SecurityLevel();
@@ -130,66 +235,95 @@ void GameBoyX::LoadBIOS(string BIOSROMName)
     }
 }
 
+// ROM files are memory mapped and shared through the ROM image registry, so instances running the same cartridge
+// (or BIOS) use one read-only image in place and only keep their own bank selection
 void GameBoyX::LoadROMBinary(std::string ROMName)
 {
-    FileLoader loader(ROMName);
-    loader.Load();   
-    auto [fileBytes, size] = loader.FileData();
+    auto file = make_shared<MappedFile>(ROMName);
+    file->Map();
 
-    if (size > DMGBCMaxDynamicROMSize + DMGBCROMBankSize)
+    if (file->Size() > DMGBCMaxROMSize)
         throw MemoryControllerException("Game ROM file larger than 2MB");
 
-    // Load Static Bank (Bank 0)
-    LoadStaticROMSection(reinterpret_cast<uint8_t*>(fileBytes.get()), size);
+    auto image = ROMImageRegistry::Instance().Acquire(shared_ptr<const uint8_t>(file, file->Data()), file->Size(), DMGBCROMBankSize);
+
+    // Map Static Bank (Bank 0)
+    MapStaticROMSection(image);
 
-    // Load Dynamic Banks (Bank 1 - N)
-    LoadDynamicROMSection(reinterpret_cast<uint8_t*>(fileBytes.get()), size);
+    // Map Dynamic Banks (Bank 1 - N)
+    MapDynamicROMSection(image);
 
-    // Restore Bank to 0
-    _memoryControllerPtr->SwitchBank(DMGBCBankedROMInitialAddress, 0llu);
+    AttachMemoryBankController(image);
 }
 
 void GameBoyX::LoadBIOSBinary(std::string ROMName)
 {
-    FileLoader loader(ROMName);
-    loader.Load();   
-    auto [fileBytes, size] = loader.FileData();
+    auto file = make_shared<MappedFile>(ROMName);
+    file->Map();
 
-    if (size > GBXSystemROMPhysicalSize)
+    if (file->Size() > GBXSystemROMPhysicalSize)
         throw MemoryControllerException("BIOS file larger than 32KB");
 
-    auto ptr = make_unique<uint8_t*>(reinterpret_cast<uint8_t*>(fileBytes.get()));
-    _memoryControllerPtr->Load(std::move(ptr), size < GBXSystemROMPhysicalSize? size : GBXSystemROMPhysicalSize, 0x0000, nullopt);
+    auto image = ROMImageRegistry::Instance().Acquire(shared_ptr<const uint8_t>(file, file->Data()), file->Size(), GBXSystemROMPhysicalSize);
+    _memoryControllerPtr->Map(image.Data, image.Size, GBXSystemROMInitialAddress);
 }
 
-void GameBoyX::LoadStaticROMSection(uint8_t* fileBytes, size_t size)
+void GameBoyX::MapStaticROMSection(ROMImage image)
 {
-    auto ptr = make_unique<uint8_t*>(fileBytes);
-    _memoryControllerPtr->Load(std::move(ptr), size < DMGBCROMBankSize? size : DMGBCROMBankSize, 0x0000, nullopt);
-    size -= DMGBCROMBankSize;
+    _memoryControllerPtr->Map(image.Data, DMGBCROMBankSize, DMGBCFixedROMInitialAddress);
 }
 
-void GameBoyX::LoadDynamicROMSection(uint8_t* fileBytes, size_t size)
+void GameBoyX::MapDynamicROMSection(ROMImage image)
 {
-    for (auto offset = 0llu, bank = 0llu; offset < DMGBCMaxDynamicROMSize && size > 0; offset += DMGBCROMBankSize)
-    {
-        auto pointerAddress = offset + DMGBCROMBankSize;
-        auto chunckSize = std::min(size, DMGBCROMBankSize);
-        auto ptr = make_unique<uint8_t*>(fileBytes + pointerAddress);
+    _memoryControllerPtr->Map(image.Data, image.Size, DMGBCBankedROMInitialAddress);
+}
+
+// Cartridges without a (supported) MBC keep bank 1 and the external RAM mapped
+void GameBoyX::AttachMemoryBankController(ROMImage image)
+{
+    auto header = image.Data.get();
+    auto type = MemoryBankControllerTypeOf(header[CartridgeTypeAddress]);
+    auto ramBankCount = ExternalRAMBankCount(header[CartridgeRAMSizeAddress]);
 
-        _memoryControllerPtr->SwitchBank(DMGBCBankedROMInitialAddress, bank++);
-        _memoryControllerPtr->Load(std::move(ptr), chunckSize, DMGBCBankedROMInitialAddress, nullopt);
+    _userExternalRAMPtr->Detach();
+    _externalRAMSize = ramBankCount * DMGBCExternalRAMPhysicalSize;
 
-        size -= DMGBCROMBankSize;
+    auto controller = CreateMemoryBankController(type, _userBankedROMPtr, _userExternalRAMPtr, ramBankCount);
+
+    if (controller == nullptr)
+    {
+        _userExternalRAMPtr->SelectBank(0);
+        _userExternalRAMPtr->Enable(true);
+        _userBankedROMPtr->SelectBank(_userBankedROMPtr->BankCount() > 1 ? 1 : 0);
     }
+
+    _memoryControllerPtr->SetMemoryBankController(std::move(controller), PrivilegeMode::User);
 }
 
+// Banks are numbered as in the cartridge (and as the MBC numbers them), so bank 1 is the first switchable one.
+// The bank the MBC selected is switched back in once the value has been read
 variant<uint8_t, uint16_t> GameBoyX::ReadROM(uint16_t address, std::optional<uint16_t> bank, interfaces::MemoryAccessType type)
 {
-    if (bank != nullopt)
-        _memoryControllerPtr->SwitchBank(address, bank.value());
+    if (bank == nullopt)
+        return _memoryControllerPtr->Read(address, type);
 
-    return _memoryControllerPtr->Read(address, type);
+    if (address < DMGBCBankedROMInitialAddress || address >= DMGBCBankedROMFinalAddress)
+        throw MemoryControllerException("only the switchable ROM window can be read from a given bank");
+
+    auto selectedBank = _userBankedROMPtr->CurrentBank();
+    _memoryControllerPtr->SwitchBank(address, bank.value());
+
+    try
+    {
+        auto value = _memoryControllerPtr->Read(address, type);
+        _memoryControllerPtr->SwitchBank(address, selectedBank);
+        return value;
+    }
+    catch (const GBXCoreException&)
+    {
+        _memoryControllerPtr->SwitchBank(address, selectedBank);
+        throw;
+    }
 }
 
 gbxcore::SecurityLevel GameBoyX::SecurityLevel()
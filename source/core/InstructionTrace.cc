@@ -0,0 +1,175 @@
+#include "InstructionTrace.h"
+
+using namespace std;
+
+namespace gbxcore
+{
+
+bool TraceRing::Push(const TraceRecord& record)
+{
+    auto head = _head.load(memory_order_relaxed);
+
+    if (head - _tail.load(memory_order_acquire) == Capacity)
+    {
+        _dropped.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+
+    _records[head & (Capacity - 1)] = record;
+    _head.store(head + 1, memory_order_release);
+    return true;
+}
+
+size_t TraceRing::Drain(vector<TraceRecord>& records)
+{
+    auto tail = _tail.load(memory_order_relaxed);
+    auto head = _head.load(memory_order_acquire);
+
+    for (auto index = tail; index != head; ++index)
+        records.push_back(_records[index & (Capacity - 1)]);
+
+    _tail.store(head, memory_order_release);
+    return head - tail;
+}
+
+size_t TraceRing::Dropped()
+{
+    return _dropped.load(memory_order_relaxed);
+}
+
+InstructionTracer::~InstructionTracer()
+{
+    Stop();
+}
+
+InstructionTracer& InstructionTracer::Instance()
+{
+    static InstructionTracer tracer;
+    return tracer;
+}
+
+void InstructionTracer::Start(string fileName, chrono::milliseconds interval)
+{
+    if (_recording.load())
+        throw TraceException("instruction trace is already being recorded");
+
+    _file.open(fileName, ios::binary | ios::trunc);
+    if (!_file.is_open())
+        throw TraceException("unable to open trace file '" + fileName + "'");
+
+    _file.write(reinterpret_cast<const char*>(&InstructionTraceFileHeader), sizeof(TraceFileHeader));
+
+    {
+        // Records left over from a previous session do not belong to this file
+        lock_guard<mutex> guard(_ringsMutex);
+        for (auto& ring : _rings)
+            ring->Drain(_pending);
+
+        _pending.clear();
+    }
+
+    _interval = interval;
+    _recording.store(true);
+    _writer = make_unique<thread>([&]() { this->RunWriter(); });
+}
+
+void InstructionTracer::Stop()
+{
+    if (!_recording.exchange(false))
+        return;
+
+    _wakeUp.notify_all();
+    _writer->join();
+    _writer.reset();
+
+    lock_guard<mutex> guard(_ringsMutex);
+    DrainRings();
+    _file.close();
+}
+
+bool InstructionTracer::IsRecording()
+{
+    return _recording.load(memory_order_relaxed);
+}
+
+size_t InstructionTracer::Dropped()
+{
+    lock_guard<mutex> guard(_ringsMutex);
+    auto dropped = 0llu;
+
+    for (auto& ring : _rings)
+        dropped += ring->Dropped();
+
+    return dropped;
+}
+
+void InstructionTracer::Record(TraceRecord record)
+{
+    if (!_recording.load(memory_order_relaxed))
+        return;
+
+    thread_local TraceRing* ring = nullptr;
+    thread_local uint32_t threadIndex = 0;
+
+    if (ring == nullptr)
+    {
+        lock_guard<mutex> guard(_ringsMutex);
+        threadIndex = static_cast<uint32_t>(_rings.size());
+        _rings.push_back(make_unique<TraceRing>());
+        ring = _rings.back().get();
+    }
+
+    record.Thread = threadIndex;
+    ring->Push(record);
+}
+
+inline void InstructionTracer::RunWriter()
+{
+    unique_lock<mutex> lock(_ringsMutex);
+
+    while (_recording.load())
+    {
+        _wakeUp.wait_for(lock, _interval, [&]() { return !_recording.load(); });
+        DrainRings();
+    }
+}
+
+inline void InstructionTracer::DrainRings()
+{
+    for (auto& ring : _rings)
+        ring->Drain(_pending);
+
+    if (_pending.size() != 0)
+        _file.write(reinterpret_cast<const char*>(_pending.data()), _pending.size() * sizeof(TraceRecord));
+
+    _pending.clear();
+}
+
+TraceFileReader::TraceFileReader(string fileName)
+    : _file(fileName, ios::binary)
+{
+    if (!_file.is_open())
+        throw TraceException("unable to open trace file '" + fileName + "'");
+
+    TraceFileHeader header{};
+    _file.read(reinterpret_cast<char*>(&header), sizeof(TraceFileHeader));
+
+    if (_file.gcount() != sizeof(TraceFileHeader) || header.Magic != InstructionTraceFileHeader.Magic)
+        throw TraceException("'" + fileName + "' is not an instruction trace file");
+
+    if (header.Version != InstructionTraceFileHeader.Version || header.RecordSize != InstructionTraceFileHeader.RecordSize)
+        throw TraceException("unsupported instruction trace version");
+}
+
+vector<TraceRecord> TraceFileReader::ReadAll()
+{
+    vector<TraceRecord> records;
+    TraceRecord record{};
+
+    while (_file.read(reinterpret_cast<char*>(&record), sizeof(TraceRecord)))
+        records.push_back(record);
+
+    return records;
+}
+
+}
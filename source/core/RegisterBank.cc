@@ -6,116 +6,101 @@ using namespace std;
 namespace gbxcore
 {
 
-RegisterBank::RegisterBank()
+RegisterBank::RegisterBank(FlagEvaluation evaluation)
     : _registers({0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0})
     , _alternates({0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0})
+    , _evaluation(evaluation)
 {}
 
-uint8_t RegisterBank::Read(Register reg)
+void RegisterBank::ThrowInvalidPair()
 {
-    assert(IsSingleRegister(reg));
-    
-    auto index = RegisterToIndex(reg);
-    return _registers[index];
+    throw RegisterBankException("invalid pair register");
 }
 
-std::uint16_t RegisterBank::ReadPair(Register reg)
+// Records the operands of the last flag-producing operation; Z, N, H and CY are only computed when read.
+// Logical operations keep the lower nibble of F, every other operation clears it.
+void RegisterBank::DeferFlags(FlagOperation operation, uint8_t operand1, uint8_t operand2, uint8_t carry)
 {
-    assert(!IsSingleRegister(reg));
+    auto& flags = _registers[RegisterToIndex(Register::F)];
+    auto isLogical = operation == FlagOperation::And || operation == FlagOperation::Or || operation == FlagOperation::Xor;
 
-    auto highIndex = PairToHighIndex(reg);
-    auto lowIndex = PairToLowIndex(reg);
+    flags = isLogical? flags & 0x0F : 0x00;
+    _deferredFlags = {operation, operand1, operand2, carry};
+    _flagsDeferred = true;
 
-    return static_cast<uint16_t>(_registers[highIndex] << 8 | _registers[lowIndex]);
+    if (_evaluation == FlagEvaluation::Eager)
+        EvaluateDeferredFlags();
 }
 
-void RegisterBank::Write(Register reg, uint8_t val)
+FlagEvaluation RegisterBank::Evaluation() const
 {
-    assert(IsSingleRegister(reg));
-
-    auto index = RegisterToIndex(reg);
-    
-    if(IsSingleRegister(reg))
-        _registers[index] = val;
-    else
-        WritePair(reg, val);
+    return _evaluation;
 }
 
-void RegisterBank::WritePair(Register reg, uint16_t val)
+void RegisterBank::SetEvaluation(FlagEvaluation evaluation)
 {
-    assert(!IsSingleRegister(reg));
-
-    auto highIndex = PairToHighIndex(reg);
-    auto lowIndex = PairToLowIndex(reg);
-
-    _registers[highIndex] = (val >> 8);
-    _registers[lowIndex] = val;
+    MaterializeFlags();
+    _evaluation = evaluation;
 }
 
-constexpr uint8_t RegisterBank::RegisterToIndex(Register reg)
+void RegisterBank::EvaluateDeferredFlags()
 {
-    return static_cast<uint8_t>(reg);
-}
+    auto flags = static_cast<uint8_t>(EvaluateFlag(Flag::Z) << static_cast<uint8_t>(Flag::Z) |
+                                      EvaluateFlag(Flag::N) << static_cast<uint8_t>(Flag::N) |
+                                      EvaluateFlag(Flag::H) << static_cast<uint8_t>(Flag::H) |
+                                      EvaluateFlag(Flag::CY) << static_cast<uint8_t>(Flag::CY));
 
-constexpr bool RegisterBank::IsSingleRegister(Register reg)
-{
-    return reg != Register::BC && reg != Register::DE && reg != Register::HL && 
-           reg != Register::AF && reg != Register::PC && reg != Register::SP &&
-           reg != Register::IX && reg != Register::IY;
+    _registers[RegisterToIndex(Register::F)] = (_registers[RegisterToIndex(Register::F)] & 0x0F) | flags;
+    _flagsDeferred = false;
 }
 
-inline uint8_t RegisterBank::PairToHighIndex(Register reg)
+uint8_t RegisterBank::EvaluateFlag(Flag flag)
 {
-    switch (reg)
-    {
-        case Register::HL:
-            return RegisterToIndex(Register::H);
-        case Register::DE:
-            return RegisterToIndex(Register::D);
-        case Register::BC:
-            return RegisterToIndex(Register::B);
-        case Register::AF:
-            return RegisterToIndex(Register::A);
-        case Register::PC:
-            return RegisterToIndex(Register::PC);
-        case Register::SP:
-            return RegisterToIndex(Register::SP);
-        case Register::IX:
-            return RegisterToIndex(Register::IX);
-        case Register::IY:
-            return RegisterToIndex(Register::IY);
-        default:
-            throw RegisterBankException("invalid pair register");
-    }
-}
+    auto [operation, operand1, operand2, carry] = _deferredFlags;
 
-inline uint8_t RegisterBank::PairToLowIndex(Register reg)
-{
-    switch (reg)
+    switch (operation)
     {
-        case Register::HL:
-            return RegisterToIndex(Register::L);
-        case Register::DE:
-            return RegisterToIndex(Register::E);
-        case Register::BC:
-            return RegisterToIndex(Register::C);
-        case Register::AF:
-            return RegisterToIndex(Register::F);
-        case Register::PC:
-            return RegisterToIndex(Register::PC) + 1;
-        case Register::SP:
-            return RegisterToIndex(Register::SP) + 1;
-        case Register::IX:
-            return RegisterToIndex(Register::IX) + 1;
-        case Register::IY:
-            return RegisterToIndex(Register::IY) + 1;
+        case FlagOperation::Add:
+        case FlagOperation::Increment:
+        {
+            auto carryIn = operation == FlagOperation::Add? carry : 0x00;
+            switch (flag)
+            {
+                case Flag::Z: return static_cast<uint8_t>(operand1 + operand2 + carryIn) == 0x00;
+                case Flag::N: return 0x00;
+                case Flag::H: return ((operand1 & 0x0F) + (operand2 & 0x0F) + carryIn) > 0x0F;
+                default: return operation == FlagOperation::Add? (operand1 + operand2 + carryIn) > 0xFF : carry;
+            }
+        }
+        case FlagOperation::Subtract:
+        case FlagOperation::Decrement:
+        {
+            auto borrowIn = operation == FlagOperation::Subtract? carry : 0x00;
+            switch (flag)
+            {
+                case Flag::Z: return static_cast<uint8_t>(operand1 - operand2 - borrowIn) == 0x00;
+                case Flag::N: return 0x01;
+                case Flag::H: return (operand1 & 0x0F) < (operand2 & 0x0F) + borrowIn;
+                default: return operation == FlagOperation::Subtract? operand1 < operand2 + borrowIn : carry;
+            }
+        }
         default:
-            throw RegisterBankException("invalid pair register");
+        {
+            auto result = operation == FlagOperation::And? operand1 & operand2 : (operation == FlagOperation::Or? operand1 | operand2 : operand1 ^ operand2);
+            switch (flag)
+            {
+                case Flag::Z: return result == 0x00;
+                case Flag::H: return operation == FlagOperation::And;
+                default: return 0x00;
+            }
+        }
     }
 }
 
 inline void RegisterBank::Swap()
 {
+    MaterializeFlags();
+
     array<uint8_t, 8> tmp;
     copy(begin(_registers), begin(_registers) + 8, begin(tmp));
     copy(begin(_alternates), end(_alternates), begin(_registers));
@@ -0,0 +1,168 @@
+#include "ThreadedControlUnit.h"
+
+#include "EventScheduler.h"
+
+using namespace std;
+using namespace gbxcore::interfaces;
+using namespace gbxcore::instructions;
+
+namespace gbxcore
+{
+
+void ThreadedControlUnit::Initialize(MemoryControllerInterface* memoryController, ArithmeticLogicUnitInterface* alu)
+{
+    ControlUnit::Initialize(memoryController, alu);
+    ObserveMemoryController(memoryController);
+}
+
+void ThreadedControlUnit::RunCycle()
+{
+    // A cycle of the threaded engine runs a whole basic block. Each instruction
+    // has been fetched and decoded at translation time, so only its execution path is dispatched
+    auto block = AcquireBlock();
+    RunBlock(*block);
+}
+
+size_t ThreadedControlUnit::RunBounded(const ExecutionBounds& bounds)
+{
+    auto block = AcquireBlock();
+    return RunBlock(*block, bounds);
+}
+
+size_t ThreadedControlUnit::RunBlock(BasicBlock& block, const ExecutionBounds& bounds)
+{
+    auto executedInstructions = 0llu;
+
+    for (auto& instruction : block.Instructions)
+    {
+        _alu->LoadPredecodedInstruction(instruction.Predecoded);
+        (this->*instruction.Handler)();
+        ++executedInstructions;
+
+        // The block may have overwritten its own code (or switched banks under it)
+        if (!block.Valid)
+            break;
+
+        // The rest of the block is translated as a block of its own when execution resumes
+        if (ReachedBounds(bounds, executedInstructions))
+            break;
+    }
+
+    return executedInstructions;
+}
+
+bool ThreadedControlUnit::ReachedBounds(const ExecutionBounds& bounds, size_t executedInstructions)
+{
+    if (executedInstructions >= bounds.Instructions)
+        return true;
+
+    auto cycles = _alu->Cycles();
+
+    if (cycles >= bounds.Cycle || (bounds.Scheduler != nullptr && cycles >= bounds.Scheduler->NextEventCycle()))
+        return true;
+
+    return bounds.Breakpoints != nullptr && bounds.Breakpoints->test(_alu->AcquireProgramCounter());
+}
+
+BasicBlockCache& ThreadedControlUnit::BlockCache()
+{
+    return _blockCache;
+}
+
+inline shared_ptr<BasicBlock> ThreadedControlUnit::AcquireBlock()
+{
+    auto mode = _memoryController->SecurityLevel();
+    auto address = _alu->AcquireProgramCounter();
+
+    if (auto block = _blockCache.Lookup(mode, address); block != nullptr)
+        return block;
+
+    auto block = TranslateBlock(mode, address);
+    _blockCache.Insert(block);
+    return block;
+}
+
+shared_ptr<BasicBlock> ThreadedControlUnit::TranslateBlock(PrivilegeMode mode, uint16_t address)
+{
+    auto block = make_shared<BasicBlock>(BasicBlock{true, mode, address, address, {}, 0, {}, false});
+    auto cursor = static_cast<size_t>(address);
+
+    while (block->Instructions.size() < MaximumBlockLength)
+    {
+        PredecodedInstruction predecoded;
+
+        // Only the first instruction is read because execution reached it; the rest are read ahead of time
+        if (block->Instructions.size() > 0 && !IsPrefetchable(cursor))
+            break;
+
+        try
+        {
+            predecoded = _alu->PredecodeInstruction(_memoryController, static_cast<uint16_t>(cursor));
+        }
+        catch (const GBXCoreException&)
+        {
+            // Let the faulting instruction start a block of its own, so that it
+            // throws at the same point of execution it would in the ControlUnit
+            if (block->Instructions.size() == 0)
+                throw;
+
+            break;
+        }
+
+        auto handler = PredecodedExecutionPaths[static_cast<size_t>(predecoded.Template.AddressingMode)];
+        block->Instructions.push_back({handler, predecoded});
+
+        cursor += predecoded.Length;
+        block->End = static_cast<uint16_t>(min<size_t>(cursor - 1, 0xFFFF));
+
+        if (IsBlockTerminator(predecoded.Template.Opcode) || cursor > 0xFFFF)
+            break;
+    }
+
+    return block;
+}
+
+inline void ThreadedControlUnit::ObserveMemoryController(MemoryControllerInterface* memoryController)
+{
+    if (_observedMemoryController == memoryController)
+        return;
+
+    if (_observedMemoryController != nullptr)
+        _observedMemoryController->UnregisterMemoryObserver(&_blockCache);
+
+    _blockCache.Flush();
+    memoryController->RegisterMemoryObserver(&_blockCache);
+    _observedMemoryController = memoryController;
+}
+
+inline bool ThreadedControlUnit::IsPrefetchable(size_t address)
+{
+    // The instruction's length is only known once it is read, so the longest one is assumed
+    auto last = min<size_t>(address + MaximumInstructionLength - 1, 0xFFFF);
+
+    for (auto byte = address; byte <= last; ++byte)
+        if (!_memoryController->IsPrefetchable(byte))
+            return false;
+
+    return true;
+}
+
+inline bool ThreadedControlUnit::IsBlockTerminator(OpcodeType opcode)
+{
+    // Besides branches, instructions that raise execution signals end a block so
+    // that the signals can be observed once the cycle returns
+    return opcode == OpcodeType::jp || 
+           opcode == OpcodeType::jr ||
+           opcode == OpcodeType::call ||
+           opcode == OpcodeType::ret ||
+           opcode == OpcodeType::reti ||
+           opcode == OpcodeType::rst ||
+           opcode == OpcodeType::jpu ||
+           opcode == OpcodeType::halt ||
+           opcode == OpcodeType::stop ||
+           opcode == OpcodeType::ei ||
+           opcode == OpcodeType::di ||
+           opcode == OpcodeType::illegal;
+}
+
+}
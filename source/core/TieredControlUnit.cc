@@ -0,0 +1,212 @@
+#include "TieredControlUnit.h"
+
+using namespace std;
+using namespace gbxcore::interfaces;
+using namespace gbxcore::memory;
+
+namespace gbxcore
+{
+
+TieredControlUnit::TieredControlUnit(RegisterBankInterface* registers, ExecutionValidation validation)
+    : _registers(registers)
+    , _validation(validation)
+{
+    if (_registers == nullptr && _validation == ExecutionValidation::Lockstep)
+        throw ControlUnitException("lockstep validation requires access to the register bank");
+}
+
+void TieredControlUnit::Initialize(MemoryControllerInterface* memoryController, ArithmeticLogicUnitInterface* alu)
+{
+    ThreadedControlUnit::Initialize(memoryController, alu);
+
+    if (_validation == ExecutionValidation::Lockstep)
+        _journal = make_unique<JournalingMemoryController>(memoryController);
+}
+
+void TieredControlUnit::RunCycle()
+{
+    RunBounded(UnboundedExecution);
+}
+
+size_t TieredControlUnit::RunBounded(const ExecutionBounds& bounds)
+{
+    auto block = AcquireTieredBlock(_memoryController->SecurityLevel(), _alu->AcquireProgramCounter());
+
+    // Code that keeps overwriting itself is left to the interpreter
+    if (block == nullptr)
+    {
+        _hotBlock.reset();
+        ControlUnit::RunCycle();
+        return 1;
+    }
+
+    size_t executedInstructions;
+
+    if (block->Interpreted)
+        executedInstructions = RunInterpretedBlock(*block, bounds);
+    else if (_validation == ExecutionValidation::Lockstep)
+        executedInstructions = RunValidatedBlock(*block, bounds);
+    else
+        executedInstructions = RunBlock(*block, bounds);
+
+    // Hot blocks are chained to their successor, which skips the block cache lookup
+    if (++block->Executions >= HotBlockThreshold)
+        _hotBlock = block;
+    else
+        _hotBlock.reset();
+
+    return executedInstructions;
+}
+
+inline shared_ptr<BasicBlock> TieredControlUnit::AcquireTieredBlock(PrivilegeMode mode, uint16_t address)
+{
+    if (_hotBlock != nullptr)
+    {
+        if (auto successor = _hotBlock->Successor.lock(); 
+            successor != nullptr && successor->Valid && successor->Mode == mode && successor->Begin == address)
+            return successor;
+    }
+
+    auto block = _blockCache.Lookup(mode, address);
+
+    if (block == nullptr)
+    {
+        if (_blockCache.Overwrites(mode, address) >= SelfModifyingCodeThreshold)
+            return nullptr;
+
+        block = TranslateBlock(mode, address);
+        _blockCache.Insert(block);
+    }
+
+    if (_hotBlock != nullptr)
+        _hotBlock->Successor = block;
+
+    return block;
+}
+
+// The block's instructions are run one at a time by the interpreter (e.g. blocks that write to registers)
+inline size_t TieredControlUnit::RunInterpretedBlock(BasicBlock& block, const ExecutionBounds& bounds)
+{
+    auto executedInstructions = 0llu;
+
+    while (executedInstructions < block.Instructions.size())
+    {
+        ControlUnit::RunCycle();
+
+        if (ReachedBounds(bounds, ++executedInstructions))
+            break;
+    }
+
+    return executedInstructions;
+}
+
+inline size_t TieredControlUnit::RunValidatedBlock(BasicBlock& block, const ExecutionBounds& bounds)
+{
+    // The block runs first, its effects are recorded and rolled back, and then the
+    // interpreter runs the same instructions, so that both results can be compared
+    auto memoryController = _memoryController;
+    _memoryController = _journal.get();
+
+    auto initialState = SaveRegisters();
+    auto initialCycles = _alu->Cycles();
+    auto executedInstructions = RunBlock(block, bounds);
+
+    // Side effects cannot be rolled back, so the block's results stand and the block is left to the interpreter
+    if (_journal->HasJournaledSideEffects())
+    {
+        _memoryController = memoryController;
+        _journal->ClearJournal();
+        block.Interpreted = true;
+        return executedInstructions;
+    }
+
+    auto blockState = SaveRegisters();
+    auto blockCycles = _alu->Cycles();
+    auto blockWrites = _journal->Journal();
+
+    _journal->Rollback();
+    RestoreRegisters(initialState);
+    _alu->RestoreCycles(initialCycles);
+
+    // The instructions were traced as the block ran
+    _alu->SuppressTracing(true);
+
+    try
+    {
+        for (auto instruction = 0llu; instruction < executedInstructions; ++instruction)
+            ControlUnit::RunCycle();
+    }
+    catch (const GBXCoreException&)
+    {
+        _alu->SuppressTracing(false);
+        _memoryController = memoryController;
+        throw;
+    }
+
+    _alu->SuppressTracing(false);
+    _memoryController = memoryController;
+    ValidateBlock(block, blockState, blockCycles, blockWrites);
+    _journal->ClearJournal();
+    return executedInstructions;
+}
+
+inline void TieredControlUnit::ValidateBlock(BasicBlock& block, RegisterSnapshot& blockState, uint64_t blockCycles, vector<JournaledWrite>& blockWrites)
+{
+    auto interpreterState = SaveRegisters();
+    auto& interpreterWrites = _journal->Journal();
+    stringstream ss;
+
+    for (auto index = 0llu; index < SnapshotRegisters.size(); ++index)
+        if (blockState.Registers[index] != interpreterState.Registers[index])
+            ss << "register " << static_cast<size_t>(SnapshotRegisters[index]) << " (block: " << static_cast<size_t>(blockState.Registers[index]) 
+               << ", interpreter: " << static_cast<size_t>(interpreterState.Registers[index]) << ") ";
+
+    for (auto index = 0llu; index < SnapshotPairs.size(); ++index)
+        if (blockState.Pairs[index] != interpreterState.Pairs[index])
+            ss << "register pair " << static_cast<size_t>(SnapshotPairs[index]) << " (block: " << blockState.Pairs[index] 
+               << ", interpreter: " << interpreterState.Pairs[index] << ") ";
+
+    if (blockState.Level != interpreterState.Level)
+        ss << "security level ";
+
+    if (blockCycles != _alu->Cycles())
+        ss << "cycles (block: " << blockCycles << ", interpreter: " << _alu->Cycles() << ") ";
+
+    if (blockWrites.size() != interpreterWrites.size() || 
+        !equal(begin(blockWrites), end(blockWrites), begin(interpreterWrites), 
+               [](auto& a, auto& b) { return a.Address == b.Address && a.NewValue == b.NewValue; }))
+        ss << "memory writes ";
+
+    if (ss.str().size() != 0)
+    {
+        stringstream message;
+        message << "lockstep validation of block at 0x" << hex << block.Begin << " diverged from the interpreter: " << dec << ss.str();
+        throw ControlUnitException(message.str());
+    }
+}
+
+inline RegisterSnapshot TieredControlUnit::SaveRegisters()
+{
+    RegisterSnapshot snapshot{_memoryController->SecurityLevel(), {}, {}};
+
+    for (auto index = 0llu; index < SnapshotRegisters.size(); ++index)
+        snapshot.Registers[index] = _registers->Read(SnapshotRegisters[index]);
+
+    for (auto index = 0llu; index < SnapshotPairs.size(); ++index)
+        snapshot.Pairs[index] = _registers->ReadPair(SnapshotPairs[index]);
+
+    return snapshot;
+}
+
+inline void TieredControlUnit::RestoreRegisters(RegisterSnapshot& snapshot)
+{
+    for (auto index = 0llu; index < SnapshotRegisters.size(); ++index)
+        _registers->Write(SnapshotRegisters[index], snapshot.Registers[index]);
+
+    for (auto index = 0llu; index < SnapshotPairs.size(); ++index)
+        _registers->WritePair(SnapshotPairs[index], snapshot.Pairs[index]);
+
+    _memoryController->SetSecurityLevel(snapshot.Level);
+}
+
+}
@@ -1,17 +1,20 @@
 #include "Z80X.h"
 
+#include "GBXCoreExceptions.h"
+
 using namespace std;
 using namespace gbxcore::interfaces;
 
 namespace gbxcore
 {
 
-void Z80X::Initialize(unique_ptr<ControlUnitInterface> controlUnit, 
-                      unique_ptr<ClockInterface> clock, 
-                      unique_ptr<ArithmeticLogicUnitInterface> alu,
-                      unique_ptr<MemoryControllerInterface> memoryController,
-                      unique_ptr<RegisterBankInterface> registers,
-                      unique_ptr<interfaces::VideoOutputInterface> videoOutput)
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+void Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::Initialize(unique_ptr<ControlUnitT> controlUnit, 
+                                                        unique_ptr<ClockInterface> clock, 
+                                                        unique_ptr<AluT> alu,
+                                                        unique_ptr<MemoryT> memoryController,
+                                                        unique_ptr<RegistersT> registers,
+                                                        unique_ptr<interfaces::VideoOutputInterface> videoOutput)
 {
     _controlUnit = std::move(controlUnit);
     _clock = std::move(clock);
@@ -24,10 +27,151 @@ void Z80X::Initialize(unique_ptr<ControlUnitInterface> controlUnit,
     _controlUnit->Initialize(_memoryController.get(), _alu.get());
 }
 
-void Z80X::Run()
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+void Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::Run()
 {
-    _controlUnit->RunCycle();
+    _instructions += _controlUnit->RunBounded(UnboundedExecution);
+    SynchronizeClock();
+    RunDueEvents();
     _videoOutput->Render();
 }
 
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+StopReason Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::RunFor(uint64_t cycles, const CancellationCheck& isCancelled)
+{
+    return RunBatch(numeric_limits<uint64_t>::max(), cycles, isCancelled);
+}
+
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+StopReason Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::RunInstructions(uint64_t instructions, const CancellationCheck& isCancelled)
+{
+    return RunBatch(instructions, numeric_limits<uint64_t>::max(), isCancelled);
+}
+
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+inline StopReason Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::RunBatch(uint64_t instructions, uint64_t cycles, const CancellationCheck& isCancelled)
+{
+    auto finalCycle = _clock->Ticks() + min(cycles, numeric_limits<uint64_t>::max() - _clock->Ticks());
+    uint64_t executed = 0;
+
+    try
+    {
+        while (executed < instructions && _clock->Ticks() < finalCycle)
+        {
+            auto checkpoint = executed + min(instructions - executed, CancellationCheckInterval);
+
+            while (executed < checkpoint && _clock->Ticks() < finalCycle)
+            {
+                // Block engines run several instructions per call, stopping where the CPU needs to observe them
+                ExecutionBounds bounds{checkpoint - executed, finalCycle, &_scheduler, _breakpointCount != 0 ? &_breakpoints : nullptr};
+                auto batch = _controlUnit->RunBounded(bounds);
+                executed += batch;
+                _instructions += batch;
+                SynchronizeClock();
+                RunDueEvents();
+
+                if (_alu->HaltSignal())
+                    return StopReason::Halt;
+
+                if (_alu->IllegalInstructionSignal())
+                {
+                    _lastError = "illegal instruction executed";
+                    return StopReason::Error;
+                }
+
+                if (_breakpointCount != 0 && _breakpoints.test(_registers->ReadPair(Register::PC)))
+                    return StopReason::Breakpoint;
+            }
+
+            if (isCancelled && isCancelled())
+                return StopReason::Cancelled;
+        }
+    }
+    catch (const GBXCoreException& e)
+    {
+        _lastError = e.what();
+        return StopReason::Error;
+    }
+
+    return StopReason::BudgetExhausted;
+}
+
+// The clock runs in machine cycles and follows the cycles accounted by the ALU for every executed instruction
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+inline void Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::SynchronizeClock()
+{
+    _clock->Advance(_alu->Cycles() - _clock->Ticks());
+}
+
+// Peripherals are not stepped along with the CPU; a single comparison per instruction tells whether any of them is due
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+inline void Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::RunDueEvents()
+{
+    if (auto ticks = _clock->Ticks(); ticks >= _scheduler.NextEventCycle()) [[unlikely]]
+        _scheduler.RunDue(ticks);
+}
+
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+void Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::Render()
+{
+    _videoOutput->Render();
+}
+
+// Cycles taken by a peripheral that halts the CPU (e.g. VRAM DMA) are accounted as if spent by the current instruction
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+void Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::Stall(uint64_t cycles)
+{
+    _alu->Stall(cycles);
+    SynchronizeClock();
+}
+
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+void Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::SetBreakpoint(uint16_t address)
+{
+    if (!_breakpoints.test(address))
+    {
+        _breakpoints.set(address);
+        ++_breakpointCount;
+    }
+}
+
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+void Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::ClearBreakpoint(uint16_t address)
+{
+    if (_breakpoints.test(address))
+    {
+        _breakpoints.reset(address);
+        --_breakpointCount;
+    }
+}
+
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+uint64_t Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::Cycles() const
+{
+    // The Clock only catches up once a whole step (e.g. a basic block) has run, whereas the ALU accounts every
+    // instruction as it executes, so peripherals reading the cycle count mid-step see the exact time
+    return _alu->Cycles();
+}
+
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+EventScheduler& Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::Scheduler()
+{
+    return _scheduler;
+}
+
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+uint64_t Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::Instructions() const
+{
+    return _instructions;
+}
+
+template<typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+const string& Z80X<ControlUnitT, AluT, RegistersT, MemoryT>::LastError() const
+{
+    return _lastError;
+}
+
+template class Z80X<>;
+template class Z80X<ControlUnit, ArithmeticLogicUnit, RegisterBank, memory::MemoryController>;
+
 }
\ No newline at end of file
@@ -22,7 +22,6 @@ void InstructionAdc::Execute(interfaces::RegisterBankInterface* registerBank, De
     auto operand2  = registerBank->Read(decodedInstruction.DestinationRegister); // Always A
     auto carry  = registerBank->ReadFlag(Flag::CY);
     
-    registerBank->Write(Register::F, 0x00);
     auto result = Calculate8BitBinaryAdditionAndSetFlags(operand1, operand2, carry, registerBank);
     registerBank->Write(decodedInstruction.DestinationRegister, static_cast<uint8_t>(result));
 }
@@ -34,7 +34,6 @@ void InstructionAdd::Add8Bit(RegisterBankInterface* registerBank, DecodedInstruc
     auto operand1 = Acquire8BitSourceOperandValue(registerBank, decodedInstruction);
     auto operand2  = registerBank->Read(decodedInstruction.DestinationRegister); // Always A
     
-    registerBank->Write(Register::F, 0x00);
     auto result = Calculate8BitBinaryAdditionAndSetFlags(operand1, operand2, nullopt, registerBank);
     registerBank->Write(decodedInstruction.DestinationRegister, static_cast<uint8_t>(result));
 }
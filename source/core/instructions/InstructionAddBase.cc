@@ -8,29 +8,10 @@ namespace gbxcore::instructions
 
 uint8_t InstructionAddBase::Calculate8BitBinaryAdditionAndSetFlags(uint8_t operand1, uint8_t operand2, optional<uint8_t> carry, interfaces::RegisterBankInterface* registerBank)
 {
-    auto result = static_cast<uint8_t>(0x00);
     auto carryIn = carry.value_or(0x00);
 
-    for (auto i = 0; i < 8; i++)
-    {
-        auto operand1Bit = (operand1 >> i) & 0x01;
-        auto operand2Bit = (operand2 >> i) & 0x01;
-        auto resultBit = (operand1Bit ^ operand2Bit) ^ carryIn;
-        carryIn = (operand1Bit & operand2Bit) | (carryIn & (operand1Bit ^ operand2Bit));
-
-        if (i == 3 && carryIn)
-            registerBank->SetFlag(Flag::H);
-        else if (i == 7 && carryIn)
-            registerBank->SetFlag(Flag::CY);
-
-        result |= (resultBit << i);
-    }
-
-    if (result == 0)
-        registerBank->SetFlag(Flag::Z);
-    registerBank->ClearFlag(Flag::N);
-
-    return result;
+    registerBank->DeferFlags(FlagOperation::Add, operand1, operand2, carryIn);
+    return static_cast<uint8_t>(operand1 + operand2 + carryIn);
 }
 
 uint16_t InstructionAddBase::Calculate16BitBinaryAdditionAndSetFlags(uint16_t operand1, uint16_t operand2, optional<uint8_t> carry, interfaces::RegisterBankInterface* registerBank, FlagMode mode)
@@ -24,31 +24,7 @@ void InstructionCp::Execute(RegisterBankInterface* registerBank, DecodedInstruct
 
 void InstructionCp::CalculateDifferenceAndSetFlags(uint8_t operand1, uint8_t operand2, RegisterBankInterface* registerBank)
 {
-    auto result = static_cast<uint8_t>(0x00);
-    auto borrowIn = static_cast<uint8_t>(0x00);
-
-    registerBank->Write(Register::F, 0x00);
-
-    for (auto i = 0; i < 8; i++)
-    {
-        auto aBit = (operand1 >> i) & 0x01;
-        auto operandBit = (operand2 >> i) & 0x01;
-
-        auto resultBit = (aBit ^ operandBit) ^ borrowIn;
-        borrowIn = (~(aBit) & operandBit) | ((~(aBit ^ operandBit)) & borrowIn);
-
-        if (i == 3 && borrowIn == 0x01)
-            registerBank->SetFlag(Flag::H);
-        else if (i == 7 && borrowIn == 0x01)
-            registerBank->SetFlag(Flag::CY);
-
-        result |= (resultBit << i);
-    }
-
-    if (result == 0x00)
-        registerBank->SetFlag(Flag::Z);
-
-    registerBank->SetFlag(Flag::N);
+    registerBank->DeferFlags(FlagOperation::Subtract, operand1, operand2, 0x00);
 }
 
 inline uint8_t InstructionCp::GetSourceOperandValue(RegisterBankInterface* registerBank, DecodedInstruction& decodedInstruction)
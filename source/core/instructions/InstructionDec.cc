@@ -28,13 +28,8 @@ void InstructionDec::Execute8bitDecrement(RegisterBankInterface* registerBank, D
     auto operandValue = Acquire8bitSourceOperandValue(registerBank, decodedInstruction);
     auto carry = registerBank->ReadFlag(Flag::CY);
 
-    registerBank->Write(Register::F, 0x00);
-    SetDestinationOperandValue(operandValue, registerBank, decodedInstruction);
-
-    if (carry)
-        registerBank->SetFlag(Flag::CY);
-    else
-        registerBank->ClearFlag(Flag::CY);    
+    registerBank->DeferFlags(FlagOperation::Decrement, operandValue, 0x01, carry);
+    SetDestinationOperandValue(static_cast<uint8_t>(operandValue - 1), registerBank, decodedInstruction);
 }
 
 void InstructionDec::Execute16bitDecrement(RegisterBankInterface* registerBank, DecodedInstruction& decodedInstruction) 
@@ -45,11 +40,10 @@ void InstructionDec::Execute16bitDecrement(RegisterBankInterface* registerBank,
 
 inline void InstructionDec::SetDestinationOperandValue(uint8_t operandValue, RegisterBankInterface* registerBank, DecodedInstruction& decodedInstruction)
 {
-    if (auto value = CalculateBinarySubtractionAndSetFlags(operandValue, 0x01, nullopt, registerBank);
-        decodedInstruction.AddressingMode == AddressingMode::Register)
-        registerBank->Write(decodedInstruction.DestinationRegister, value);
+    if (decodedInstruction.AddressingMode == AddressingMode::Register)
+        registerBank->Write(decodedInstruction.DestinationRegister, operandValue);
     else 
-        decodedInstruction.MemoryResult1 = value;
+        decodedInstruction.MemoryResult1 = operandValue;
 }
 
 inline void InstructionDec::DecodeDecRegisterMode(uint8_t opcode, DecodedInstruction& decodedInstruction)
@@ -0,0 +1,32 @@
+#include "InstructionIllegal.h"
+
+using namespace gbxcore::interfaces;
+using namespace std;
+
+namespace gbxcore::instructions
+{
+
+void InstructionIllegal::Decode(uint8_t opcode, [[maybe_unused]] optional<uint8_t> preOpcode, DecodedInstruction& decodedInstruction)
+{
+    decodedInstruction =
+    {
+        .Opcode = OpcodeType::illegal,
+        .AddressingMode = AddressingMode::Register,
+        .MemoryOperand1 = 0x00,
+        .MemoryOperand2 = 0x00,
+        .MemoryOperand3 = 0x00,
+        .SourceRegister = Register::NoRegister,
+        .DestinationRegister = Register::NoRegister,
+        .MemoryResult1 = 0x00,
+        .MemoryResult2 = 0x00,
+        .InstructionExtraOperand = opcode
+    };
+}
+
+void InstructionIllegal::Execute([[maybe_unused]] RegisterBankInterface* registerBank, [[maybe_unused]] DecodedInstruction& decodedInstruction)
+{
+    // The trap itself is signaled by the ALU (see IllegalInstructionSignal)
+    return;
+}
+
+}
\ No newline at end of file
@@ -28,13 +28,8 @@ inline void InstructionInc::Execute8bitIncrement(RegisterBankInterface* register
     auto operandValue = Acquire8BitSourceOperandValue(registerBank, decodedInstruction);
     auto carry = registerBank->ReadFlag(Flag::CY);
 
-    registerBank->Write(Register::F, 0x00);
-    SetDestinationOperandValue(operandValue, registerBank, decodedInstruction);
-
-    if (carry)
-        registerBank->SetFlag(Flag::CY);
-    else
-        registerBank->ClearFlag(Flag::CY); 
+    registerBank->DeferFlags(FlagOperation::Increment, operandValue, 0x01, carry);
+    SetDestinationOperandValue(static_cast<uint8_t>(operandValue + 1), registerBank, decodedInstruction);
 }
 
 inline void InstructionInc::Execute16bitIncrement(RegisterBankInterface* registerBank, DecodedInstruction& decodedInstruction)
@@ -45,11 +40,10 @@ inline void InstructionInc::Execute16bitIncrement(RegisterBankInterface* registe
 
 inline void InstructionInc::SetDestinationOperandValue(uint8_t operandValue, RegisterBankInterface* registerBank, DecodedInstruction& decodedInstruction)
 {
-    if (auto value = Calculate8BitBinaryAdditionAndSetFlags(operandValue, 0x01, nullopt, registerBank);
-        decodedInstruction.AddressingMode == AddressingMode::Register)
-        registerBank->Write(decodedInstruction.DestinationRegister, value);
+    if (decodedInstruction.AddressingMode == AddressingMode::Register)
+        registerBank->Write(decodedInstruction.DestinationRegister, operandValue);
     else 
-        decodedInstruction.MemoryResult1 = value;
+        decodedInstruction.MemoryResult1 = operandValue;
 }
 
 inline void InstructionInc::DecodeIncRegisterMode(uint8_t opcode, DecodedInstruction& decodedInstruction)
@@ -16,7 +16,7 @@ void InstructionJp::Decode([[maybe_unused]] uint8_t opcode, [[maybe_unused]] std
         DecodeConditionalJp(opcode, decodedInstruction);
 }
 
-void InstructionJp::Execute(RegisterBankInterface* registerBank, interfaces::DecodedInstruction& decodedInstruction) 
+bool InstructionJp::ConditionallyExecute(RegisterBankInterface* registerBank, interfaces::DecodedInstruction& decodedInstruction) 
 {
     // Flag to indicate which jump typ it is
     if (decodedInstruction.InstructionExtraOperand == 0xFF)
@@ -24,10 +24,12 @@ void InstructionJp::Execute(RegisterBankInterface* registerBank, interfaces::Dec
     else if (decodedInstruction.InstructionExtraOperand == 0xFE)
         ExecuteUnconditionalJpRegisterIndirect(registerBank, decodedInstruction);
     else
-        ExecuteConditionalJp(registerBank, decodedInstruction);
+        return ExecuteConditionalJp(registerBank, decodedInstruction);
+
+    return false;
 }
 
-void InstructionJp::ExecuteConditionalJp(RegisterBankInterface* registerBank, interfaces::DecodedInstruction& decodedInstruction) 
+bool InstructionJp::ExecuteConditionalJp(RegisterBankInterface* registerBank, interfaces::DecodedInstruction& decodedInstruction) 
 {
     auto condition = decodedInstruction.InstructionExtraOperand;
     auto zFlag = registerBank->ReadFlag(Flag::Z);
@@ -35,7 +37,12 @@ void InstructionJp::ExecuteConditionalJp(RegisterBankInterface* registerBank, in
 
     if ((condition == 0x00 && zFlag == 0x00) || (condition == 0x01 && zFlag == 0x01) ||
         (condition == 0x02 && cyFlag == 0x00) || (condition == 0x03 && cyFlag == 0x01))
+    {
         ExecuteUnconditionalJp(registerBank, decodedInstruction);
+        return false;
+    }
+    else
+        return true;
 }
 
 void InstructionJp::ExecuteUnconditionalJp(RegisterBankInterface* registerBank, interfaces::DecodedInstruction& decodedInstruction) 
@@ -14,12 +14,13 @@ void InstructionJr::Decode(uint8_t opcode, [[maybe_unused]] std::optional<uint8_
         DecodeConditionalJr(opcode, decodedInstruction);
 }
 
-void InstructionJr::Execute(RegisterBankInterface* registerBank, interfaces::DecodedInstruction& decodedInstruction) 
+bool InstructionJr::ConditionallyExecute(RegisterBankInterface* registerBank, interfaces::DecodedInstruction& decodedInstruction) 
 {
-    if (decodedInstruction.InstructionExtraOperand == 0xFF)
-        ExecuteUnconditionalJr(registerBank, decodedInstruction);
-    else
-        ExecuteConditionalJr(registerBank, decodedInstruction);
+    if (decodedInstruction.InstructionExtraOperand != 0xFF)
+        return ExecuteConditionalJr(registerBank, decodedInstruction);
+
+    ExecuteUnconditionalJr(registerBank, decodedInstruction);
+    return false;
 }
 
 inline void InstructionJr::ExecuteUnconditionalJr(RegisterBankInterface* registerBank, interfaces::DecodedInstruction& decodedInstruction)
@@ -29,7 +30,7 @@ inline void InstructionJr::ExecuteUnconditionalJr(RegisterBankInterface* registe
     registerBank->WritePair(Register::PC, targetPCAddress);
 }
 
-inline void InstructionJr::ExecuteConditionalJr(RegisterBankInterface* registerBank, interfaces::DecodedInstruction& decodedInstruction)
+inline bool InstructionJr::ExecuteConditionalJr(RegisterBankInterface* registerBank, interfaces::DecodedInstruction& decodedInstruction)
 {
     auto condition = decodedInstruction.InstructionExtraOperand;
     auto zFlag = registerBank->ReadFlag(Flag::Z);
@@ -37,7 +38,12 @@ inline void InstructionJr::ExecuteConditionalJr(RegisterBankInterface* registerB
 
     if ((condition == 0x00 && zFlag == 0x00) || (condition == 0x01 && zFlag == 0x01) ||
         (condition == 0x02 && cyFlag == 0x00) || (condition == 0x03 && cyFlag == 0x01))
+    {
         ExecuteUnconditionalJr(registerBank, decodedInstruction);
+        return false;
+    }
+    else
+        return true;
 }
 
 inline void InstructionJr::DecodeUnconditionalJr(interfaces::DecodedInstruction& decodedInstruction)
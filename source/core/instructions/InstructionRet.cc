@@ -14,15 +14,16 @@ void InstructionRet::Decode(uint8_t opcode, optional<uint8_t> preOpcode, Decoded
         DecodeConditionalRet(opcode, preOpcode, decodedInstruction);
 }
 
-void InstructionRet::Execute(RegisterBankInterface* registerBank, DecodedInstruction& decodedInstruction)
+bool InstructionRet::ConditionallyExecute(RegisterBankInterface* registerBank, DecodedInstruction& decodedInstruction)
 {
-    if (decodedInstruction.InstructionExtraOperand == 0xFF)
-        ExecuteUnconditionalRet(registerBank, decodedInstruction);
-    else
-        ExecuteConditionalRet(registerBank, decodedInstruction);
+    if (decodedInstruction.InstructionExtraOperand != 0xFF)
+        return ExecuteConditionalRet(registerBank, decodedInstruction);
+
+    ExecuteUnconditionalRet(registerBank, decodedInstruction);
+    return false;
 }
 
-inline void InstructionRet::ExecuteConditionalRet(RegisterBankInterface* registerBank, DecodedInstruction& decodedInstruction)
+inline bool InstructionRet::ExecuteConditionalRet(RegisterBankInterface* registerBank, DecodedInstruction& decodedInstruction)
 {
     auto condition = decodedInstruction.InstructionExtraOperand;
     auto zFlag = registerBank->ReadFlag(Flag::Z);
@@ -30,12 +31,16 @@ inline void InstructionRet::ExecuteConditionalRet(RegisterBankInterface* registe
 
     if ((condition == 0x00 && zFlag == 0x00) || (condition == 0x01 && zFlag == 0x01) ||
         (condition == 0x02 && cyFlag == 0x00) || (condition == 0x03 && cyFlag == 0x01))
+    {
         ExecuteUnconditionalRet(registerBank, decodedInstruction);
+        return false;
+    }
     else
     {
         auto currentSp = registerBank->ReadPair(Register::SP);
         currentSp -= 2;
         registerBank->WritePair(Register::SP, currentSp);
+        return true;
     }
 }
 
@@ -22,7 +22,6 @@ void InstructionSbc::Execute(RegisterBankInterface* registerBank, DecodedInstruc
     auto operand2 = Acquire8bitSourceOperandValue(registerBank, decodedInstruction);
     auto borrow  = registerBank->ReadFlag(Flag::CY);
 
-    registerBank->Write(Register::F, 0x00);
     auto result = CalculateBinarySubtractionAndSetFlags(operand1, operand2, borrow, registerBank);
     registerBank->Write(decodedInstruction.DestinationRegister, static_cast<uint8_t>(result));
 }
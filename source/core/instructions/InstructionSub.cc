@@ -21,7 +21,6 @@ void InstructionSub::Execute(RegisterBankInterface* registerBank, DecodedInstruc
     auto operand1  = registerBank->Read(decodedInstruction.DestinationRegister); // Always A
     auto operand2 = Acquire8bitSourceOperandValue(registerBank, decodedInstruction);
     
-    registerBank->Write(Register::F, 0x00);
     auto result = CalculateBinarySubtractionAndSetFlags(operand1, operand2, nullopt, registerBank);
     registerBank->Write(decodedInstruction.DestinationRegister, static_cast<uint8_t>(result));
 }
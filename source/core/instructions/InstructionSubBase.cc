@@ -21,31 +21,10 @@ uint16_t InstructionSubBase::Acquire16bitSourceOperandValue(RegisterBankInterfac
 
 uint8_t InstructionSubBase::CalculateBinarySubtractionAndSetFlags(uint8_t operand1, uint8_t operand2, optional<uint8_t> borrow, RegisterBankInterface* registerBank)
 {
-    auto result = static_cast<uint8_t>(0x00);
     auto borrowIn = borrow.value_or(0x00);
 
-    for (auto i = 0; i < 8; i++)
-    {
-        auto aBit = (operand1 >> i) & 0x01;
-        auto operandBit = (operand2 >> i) & 0x01;
-
-        auto resultBit = (aBit ^ operandBit) ^ borrowIn;
-        borrowIn = (~(aBit) & operandBit) | ((~(aBit ^ operandBit)) & borrowIn);
-
-        if (i == 3 && borrowIn == 0x01)
-            registerBank->SetFlag(Flag::H);
-        else if (i == 7 && borrowIn == 0x01)
-            registerBank->SetFlag(Flag::CY);
-
-        result |= (resultBit << i);
-    }
-
-    if (result == 0x00)
-        registerBank->SetFlag(Flag::Z);
-
-    registerBank->SetFlag(Flag::N);
-
-    return result;
+    registerBank->DeferFlags(FlagOperation::Subtract, operand1, operand2, borrowIn);
+    return static_cast<uint8_t>(operand1 - operand2 - borrowIn);
 }
 
 }
\ No newline at end of file
@@ -20,15 +20,7 @@ void InstructionXor::Execute(RegisterBankInterface* registerBank, DecodedInstruc
     auto operand1 = GetSourceOperandValue(registerBank, decodedInstruction);
     auto operand2 = registerBank->Read(decodedInstruction.DestinationRegister);
     registerBank->Write(decodedInstruction.DestinationRegister, operand1 ^ operand2);
-
-    registerBank->ClearFlag(Flag::CY);
-    registerBank->ClearFlag(Flag::H);
-    registerBank->ClearFlag(Flag::N);
-
-    if ((operand1 ^ operand2) == 0)
-        registerBank->SetFlag(Flag::Z);
-    else
-        registerBank->ClearFlag(Flag::Z);
+    registerBank->DeferFlags(FlagOperation::Xor, operand1, operand2, 0x00);
 }
 
 inline uint8_t InstructionXor::GetSourceOperandValue(RegisterBankInterface* registerBank, DecodedInstruction& decodedInstruction)
@@ -0,0 +1,78 @@
+#include "BankedRAM.h"
+
+using namespace gbxcore::interfaces;
+using namespace std;
+
+namespace gbxcore::memory
+{
+
+BankedRAM::BankedRAM(size_t resourceSize, size_t bankSize)
+    : BankedROM(resourceSize, bankSize)
+{}
+
+uint8_t BankedRAM::ReadByte(size_t address)
+{
+    if (!_enabled) [[unlikely]]
+        return 0xFF;
+
+    return BankedROM::ReadByte(address);
+}
+
+uint16_t BankedRAM::ReadWord(size_t address)
+{
+    if (!_enabled) [[unlikely]]
+        return 0xFFFF;
+
+    return BankedROM::ReadWord(address);
+}
+
+void BankedRAM::WriteByte(uint8_t value, size_t address)
+{
+    if (address >= _bankSize) [[unlikely]]
+        ThrowOutOfBank(address, MemoryAccessType::Byte);
+
+    if (_enabled) [[likely]]
+        _bankBase[address] = value;
+}
+
+void BankedRAM::WriteWord(uint16_t value, size_t address)
+{
+    if (address + 1 >= _bankSize) [[unlikely]]
+        ThrowOutOfBank(address, MemoryAccessType::Word);
+
+    if (_enabled) [[likely]]
+    {
+        _bankBase[address] = value & 0xFF;
+        _bankBase[address + 1] = (value >> 8) & 0xFF;
+    }
+}
+
+// RAM is written to, so mapped content is always copied into its own storage
+void BankedRAM::Map(shared_ptr<const uint8_t> content, size_t size)
+{
+    _size = _capacity;
+    CopyFrom(content.get(), size);
+    UpdateBankBase();
+}
+
+uint8_t* BankedRAM::Data()
+{
+    return _enabled ? _bankBase : nullptr;
+}
+
+bool BankedRAM::IsWritable()
+{
+    return true;
+}
+
+void BankedRAM::Enable(bool enabled)
+{
+    _enabled = enabled;
+}
+
+bool BankedRAM::IsEnabled()
+{
+    return _enabled;
+}
+
+}
@@ -9,8 +9,16 @@ namespace gbxcore::memory
 BankedROM::BankedROM(size_t resourceSize, size_t bankSize)
     : ROM(resourceSize)
     , _bankSize(bankSize)
+    , _capacity(resourceSize)
+    , _bankBase(_data)
 {}
 
+// Only the active bank is directly addressable, so that the memory controller can map it page by page
+uint8_t* BankedROM::Data()
+{
+    return _bankBase;
+}
+
 size_t BankedROM::PhysicalResourceSize()
 {
     return ROM::Size();
@@ -45,41 +53,87 @@ void BankedROM::SelectBank(size_t bank)
         throw BankedMemoryException(ss.str()); 
     }
     _activeBank = bank;
+    UpdateBankBase();
+}
+
+uint8_t BankedROM::ReadByte(size_t address)
+{
+    EvaluateAddress<MemoryAccessType::Byte>(address);
+    return _bankBase[address];
 }
 
-variant<uint8_t, uint16_t> BankedROM::Read(size_t address, MemoryAccessType type)
+uint16_t BankedROM::ReadWord(size_t address)
 {
-    EvaluateAddress(address, type);
-    size_t addressOffset = _bankSize * _activeBank;
-    return ROM::Read(addressOffset + address, type);
+    EvaluateAddress<MemoryAccessType::Word>(address);
+    return static_cast<uint16_t>(_bankBase[address + 1] << 8 | _bankBase[address]);
 }
 
-void BankedROM::Write(variant<uint8_t, uint16_t> value, size_t address)
+void BankedROM::WriteByte(uint8_t value, size_t address)
 {
-    EvaluateAddress(address, value.index() == 0 ? MemoryAccessType::Byte : MemoryAccessType::Word);
-    ROM::Write(value, address);
+    EvaluateAddress<MemoryAccessType::Byte>(address);
+    ROM::WriteByte(value, address);
+}
+
+void BankedROM::WriteWord(uint16_t value, size_t address)
+{
+    EvaluateAddress<MemoryAccessType::Word>(address);
+    ROM::WriteWord(value, address);
 }
 
 void BankedROM::Load(shared_ptr<uint8_t*> content, size_t size, optional<size_t> offset)
 {
     size_t addressOffset = _bankSize * _activeBank + offset.value_or(0);
     ROM::Load(content, size, addressOffset);
+    UpdateBankBase();
+}
+
+// Content made of whole banks is mapped in place and determines the number of banks; anything else is copied
+// into a ROM of the original capacity.
+void BankedROM::Map(shared_ptr<const uint8_t> content, size_t size)
+{
+    if (size > 0 && size < _capacity && size % _bankSize == 0)
+        _size = size;
+    else
+        _size = _capacity;
+
+    ROM::Map(std::move(content), size);
+
+    if (_activeBank >= BankCount())
+        _activeBank = 0;
+
+    UpdateBankBase();
 }
 
-void BankedROM::EvaluateAddress(size_t address, MemoryAccessType type)
+void BankedROM::UpdateBankBase()
 {
-    if (type == MemoryAccessType::Byte && address >= _bankSize)
+    _bankBase = _data + _bankSize * _activeBank;
+}
+
+template<MemoryAccessType AccessType>
+inline void BankedROM::EvaluateAddress(size_t address)
+{
+    if constexpr (AccessType == MemoryAccessType::Byte)
     {
-        stringstream ss;
-        ss << "Address '" << address << "' is out of bank '" << _activeBank << "' bounds (bank size = " << _bankSize << ")";
-        throw BankedMemoryException(ss.str());       
+        if (address >= _bankSize) [[unlikely]]
+            ThrowOutOfBank(address, AccessType);
     }
-    else if (type == MemoryAccessType::Word && (address >= _bankSize || address + 1 >= _bankSize))
+    else
     {
-        stringstream ss;
-        ss << "Addresses '" << address << "' and '" << address + 1 << "' are out of bank '" << _activeBank << "' bounds (bank size = " << _bankSize << ")";
-        throw BankedMemoryException(ss.str());       
+        if (address + 1 >= _bankSize) [[unlikely]]
+            ThrowOutOfBank(address, AccessType);
     }
 }
 
+void BankedROM::ThrowOutOfBank(size_t address, MemoryAccessType type)
+{
+    stringstream ss;
+
+    if (type == MemoryAccessType::Byte)
+        ss << "Address '" << address << "' is out of bank '" << _activeBank << "' bounds (bank size = " << _bankSize << ")";
+    else
+        ss << "Addresses '" << address << "' and '" << address + 1 << "' are out of bank '" << _activeBank << "' bounds (bank size = " << _bankSize << ")";
+
+    throw BankedMemoryException(ss.str());
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "BatteryBackedRAM.h"
+
+using namespace gbxcommons;
+using namespace std;
+
+namespace gbxcore::memory
+{
+
+BatteryBackedRAM::BatteryBackedRAM(size_t resourceSize, size_t bankSize)
+    : BankedRAM(resourceSize, bankSize)
+{}
+
+void BatteryBackedRAM::WriteByte(uint8_t value, size_t address)
+{
+    BankedRAM::WriteByte(value, address);
+
+    if (_saveFile != nullptr && IsEnabled())
+        _saveFile->MarkDirty(_activeBank * _bankSize + address);
+}
+
+void BatteryBackedRAM::WriteWord(uint16_t value, size_t address)
+{
+    BankedRAM::WriteWord(value, address);
+
+    if (_saveFile != nullptr && IsEnabled())
+    {
+        _saveFile->MarkDirty(_activeBank * _bankSize + address);
+        _saveFile->MarkDirty(_activeBank * _bankSize + address + 1);
+    }
+}
+
+// Writes have to reach the resource to be tracked, whether or not a save file is attached yet
+uint8_t* BatteryBackedRAM::Data()
+{
+    return nullptr;
+}
+
+// The save file content becomes the RAM content and its size the number of banks available
+void BatteryBackedRAM::Attach(unique_ptr<SaveFile> saveFile)
+{
+    if (saveFile->Size() == 0 || saveFile->Size() > _capacity || saveFile->Size() % _bankSize != 0)
+    {
+        stringstream ss;
+        ss << "save file size (" << saveFile->Size() << ") is not a whole number of RAM banks up to " << _capacity << " bytes";
+        throw MemoryAccessException(ss.str());
+    }
+
+    _saveFile = std::move(saveFile);
+    _data = _saveFile->Data();
+    _size = _saveFile->Size();
+    _activeBank = _activeBank < BankCount() ? _activeBank : 0;
+    UpdateBankBase();
+}
+
+// Detaching flushes and unmaps the save file; the RAM starts over empty
+void BatteryBackedRAM::Detach()
+{
+    if (_saveFile == nullptr)
+        return;
+
+    _saveFile.reset();
+    _rom = AllocateZeroPages<uint8_t>(_capacity);
+    _data = _rom.get();
+    _size = _capacity;
+    _activeBank = 0;
+    UpdateBankBase();
+}
+
+SaveFile* BatteryBackedRAM::Save()
+{
+    return _saveFile.get();
+}
+
+}
@@ -0,0 +1,206 @@
+#include "JournalingMemoryController.h"
+
+using namespace std;
+using namespace gbxcore::interfaces;
+
+namespace gbxcore::memory
+{
+
+JournalingMemoryController::JournalingMemoryController(MemoryControllerInterface* memoryController)
+    : _memoryController(memoryController)
+{
+    if (_memoryController == nullptr)
+        throw MemoryControllerException("journaling memory controller requires a memory controller to journal");
+}
+
+variant<uint8_t, uint16_t> JournalingMemoryController::Read(size_t address, MemoryAccessType accessType)
+{
+    return _memoryController->Read(address, accessType);
+}
+
+void JournalingMemoryController::Write(variant<uint8_t, uint16_t> value, size_t address)
+{
+    if (holds_alternative<uint8_t>(value))
+        WriteByte(get<uint8_t>(value), address);
+    else
+        WriteWord(get<uint16_t>(value), address);
+}
+
+uint8_t JournalingMemoryController::ReadByte(size_t address)
+{
+    return _memoryController->ReadByte(address);
+}
+
+uint16_t JournalingMemoryController::ReadWord(size_t address)
+{
+    return _memoryController->ReadWord(address);
+}
+
+uint8_t JournalingMemoryController::ReadByteAs(PrivilegeMode mode, size_t address)
+{
+    return _memoryController->ReadByteAs(mode, address);
+}
+
+void JournalingMemoryController::WriteByte(uint8_t value, size_t address)
+{
+    auto firstEntry = BeginJournalEntries(address, 1);
+    _memoryController->WriteByte(value, address);
+    CompleteJournalEntries(firstEntry);
+}
+
+void JournalingMemoryController::WriteWord(uint16_t value, size_t address)
+{
+    auto firstEntry = BeginJournalEntries(address, 2);
+    _memoryController->WriteWord(value, address);
+    CompleteJournalEntries(firstEntry);
+}
+
+void JournalingMemoryController::ReadBlock(size_t address, span<uint8_t> destination)
+{
+    _memoryController->ReadBlock(address, destination);
+}
+
+void JournalingMemoryController::WriteBlock(span<const uint8_t> source, size_t address)
+{
+    auto firstEntry = BeginJournalEntries(address, source.size());
+    _memoryController->WriteBlock(source, address);
+    CompleteJournalEntries(firstEntry);
+}
+
+void JournalingMemoryController::CopyBlock(size_t source, size_t destination, size_t size)
+{
+    auto firstEntry = BeginJournalEntries(destination, size);
+    _memoryController->CopyBlock(source, destination, size);
+    CompleteJournalEntries(firstEntry);
+}
+
+bool JournalingMemoryController::HasSideEffects(size_t address)
+{
+    return _memoryController->HasSideEffects(address);
+}
+
+bool JournalingMemoryController::IsPrefetchable(size_t address)
+{
+    return _memoryController->IsPrefetchable(address);
+}
+
+void JournalingMemoryController::PokeByte(uint8_t value, size_t address)
+{
+    _memoryController->PokeByte(value, address);
+}
+
+void JournalingMemoryController::Load(unique_ptr<uint8_t*> data, size_t size, size_t address, optional<size_t> offset)
+{
+    _memoryController->Load(std::move(data), size, address, offset);
+}
+
+void JournalingMemoryController::Map(shared_ptr<const uint8_t> content, size_t size, size_t address)
+{
+    _memoryController->Map(std::move(content), size, address);
+}
+
+void JournalingMemoryController::SwitchBank(size_t address, size_t bank)
+{
+    _memoryController->SwitchBank(address, bank);
+}
+
+void JournalingMemoryController::SetSecurityLevel(gbxcore::SecurityLevel level)
+{
+    _memoryController->SetSecurityLevel(level);
+}
+
+gbxcore::SecurityLevel JournalingMemoryController::SecurityLevel()
+{
+    return _memoryController->SecurityLevel();
+}
+
+size_t JournalingMemoryController::RegisterMemoryResource(unique_ptr<MemoryResource> resource, AddressRange range, PrivilegeMode mode)
+{
+    return _memoryController->RegisterMemoryResource(std::move(resource), range, mode);
+}
+
+void JournalingMemoryController::UnregisterMemoryResource(size_t resourceID, PrivilegeMode mode)
+{
+    _memoryController->UnregisterMemoryResource(resourceID, mode);
+}
+
+void JournalingMemoryController::RegisterMemoryMappedRegister(unique_ptr<MemoryMappedRegister> memoryMappedRegister, size_t address, PrivilegeMode mode)
+{
+    _memoryController->RegisterMemoryMappedRegister(std::move(memoryMappedRegister), address, mode);
+}
+
+void JournalingMemoryController::UnregisterMemoryMappedRegister(size_t address, PrivilegeMode mode)
+{
+    _memoryController->UnregisterMemoryMappedRegister(address, mode);
+}
+
+void JournalingMemoryController::RegisterMemoryObserver(MemoryObserver* observer)
+{
+    _memoryController->RegisterMemoryObserver(observer);
+}
+
+void JournalingMemoryController::UnregisterMemoryObserver(MemoryObserver* observer)
+{
+    _memoryController->UnregisterMemoryObserver(observer);
+}
+
+const vector<JournaledWrite>& JournalingMemoryController::Journal()
+{
+    return _journal;
+}
+
+// Writes with side effects (registers, bank control) cannot be undone by restoring a value
+bool JournalingMemoryController::HasJournaledSideEffects()
+{
+    return _sideEffects;
+}
+
+void JournalingMemoryController::ClearJournal()
+{
+    _journal.clear();
+    _sideEffects = false;
+}
+
+// Old values are poked back, so that restoring them neither dispatches to registers nor replays bank switches.
+// Write-only locations (whose previous content could not be read back) are left as they are.
+void JournalingMemoryController::Rollback()
+{
+    for (auto entry = rbegin(_journal); entry != rend(_journal); ++entry)
+        if (entry->OldValue.has_value())
+            _memoryController->PokeByte(entry->OldValue.value(), entry->Address);
+
+    ClearJournal();
+}
+
+inline optional<uint8_t> JournalingMemoryController::TryRead(size_t address)
+{
+    try
+    {
+        return _memoryController->ReadByte(address);
+    }
+    catch (const GBXCoreException&)
+    {
+        return nullopt;
+    }
+}
+
+inline size_t JournalingMemoryController::BeginJournalEntries(size_t address, size_t size)
+{
+    auto firstEntry = _journal.size();
+
+    for (auto offset = 0llu; offset < size; ++offset)
+    {
+        _sideEffects = _sideEffects || _memoryController->HasSideEffects(address + offset);
+        _journal.push_back({address + offset, TryRead(address + offset), nullopt});
+    }
+
+    return firstEntry;
+}
+
+inline void JournalingMemoryController::CompleteJournalEntries(size_t firstEntry)
+{
+    for (auto entry = firstEntry; entry < _journal.size(); ++entry)
+        _journal[entry].NewValue = TryRead(_journal[entry].Address);
+}
+
+}
\ No newline at end of file
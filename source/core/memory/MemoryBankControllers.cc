@@ -0,0 +1,166 @@
+#include "MemoryBankControllers.h"
+
+using namespace std;
+using namespace gbxcore::interfaces;
+
+namespace gbxcore::memory
+{
+
+MemoryBankControllerType MemoryBankControllerTypeOf(uint8_t cartridgeType)
+{
+    switch (cartridgeType)
+    {
+        case 0x00: case 0x08: case 0x09: return MemoryBankControllerType::None;
+        case 0x01: case 0x02: case 0x03: return MemoryBankControllerType::MBC1;
+        case 0x0F: case 0x10: case 0x11: case 0x12: case 0x13: return MemoryBankControllerType::MBC3;
+        case 0x19: case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E: return MemoryBankControllerType::MBC5;
+        default: return MemoryBankControllerType::Unsupported;
+    }
+}
+
+size_t ExternalRAMBankCount(uint8_t ramSizeCode)
+{
+    switch (ramSizeCode)
+    {
+        case 0x01: case 0x02: return 1;
+        case 0x03: return 4;
+        case 0x04: return 16;
+        case 0x05: return 8;
+        default: return 0;
+    }
+}
+
+unique_ptr<MemoryBankController> CreateMemoryBankController(MemoryBankControllerType type, BankedMemoryResource* rom, BankedRAM* ram, size_t ramBankCount)
+{
+    switch (type)
+    {
+        case MemoryBankControllerType::MBC1: return make_unique<MBC1>(rom, ram, ramBankCount);
+        case MemoryBankControllerType::MBC3: return make_unique<MBC3>(rom, ram, ramBankCount);
+        case MemoryBankControllerType::MBC5: return make_unique<MBC5>(rom, ram, ramBankCount);
+        default: return nullptr;
+    }
+}
+
+CartridgeMemoryBankController::CartridgeMemoryBankController(BankedMemoryResource* rom, BankedRAM* ram, size_t ramBankCount)
+    : _rom(rom)
+    , _ram(ram)
+    , _ramBankCount(ram != nullptr ? min(ramBankCount, ram->BankCount()) : 0)
+{
+    SelectROMBank(1);
+    SelectRAMBank(0);
+    EnableRAM(false);
+}
+
+AddressRange CartridgeMemoryBankController::ControlRange()
+{
+    return AddressRange(0x0000, 0x8000, RangeType::BeginInclusive);
+}
+
+size_t CartridgeMemoryBankController::ROMBank()
+{
+    return _romBank;
+}
+
+size_t CartridgeMemoryBankController::RAMBank()
+{
+    return _ramBank;
+}
+
+bool CartridgeMemoryBankController::IsRAMEnabled()
+{
+    return _ramEnabled;
+}
+
+void CartridgeMemoryBankController::SelectROMBank(size_t bank)
+{
+    _romBank = bank % _rom->BankCount();
+    _rom->SelectBank(_romBank);
+}
+
+void CartridgeMemoryBankController::SelectRAMBank(size_t bank)
+{
+    if (_ramBankCount == 0)
+        return;
+
+    _ramBank = bank % _ramBankCount;
+    _ram->SelectBank(_ramBank);
+}
+
+void CartridgeMemoryBankController::EnableRAM(bool enabled)
+{
+    _ramEnabled = enabled && _ramBankCount > 0;
+
+    if (_ram != nullptr)
+        _ram->Enable(_ramEnabled);
+}
+
+MBC1::MBC1(BankedMemoryResource* rom, BankedRAM* ram, size_t ramBankCount)
+    : CartridgeMemoryBankController(rom, ram, ramBankCount)
+{}
+
+void MBC1::Write(uint16_t address, uint8_t value)
+{
+    if (address < 0x2000)
+        EnableRAM((value & 0x0F) == 0x0A);
+    else if (address < 0x4000)
+        _lowerBankBits = (value & 0x1F) == 0 ? 0x01 : value & 0x1F;
+    else if (address < 0x6000)
+        _upperBankBits = value & 0x03;
+    else
+        _ramBankingMode = (value & 0x01) != 0;
+
+    UpdateBanks();
+}
+
+// The upper bits always extend the ROM bank number; in RAM banking mode they also select the RAM bank
+inline void MBC1::UpdateBanks()
+{
+    SelectROMBank(static_cast<size_t>(_upperBankBits << 5 | _lowerBankBits));
+    SelectRAMBank(_ramBankingMode ? _upperBankBits : 0);
+}
+
+MBC3::MBC3(BankedMemoryResource* rom, BankedRAM* ram, size_t ramBankCount)
+    : CartridgeMemoryBankController(rom, ram, ramBankCount)
+{}
+
+void MBC3::Write(uint16_t address, uint8_t value)
+{
+    if (address < 0x2000)
+        _accessEnabled = (value & 0x0F) == 0x0A;
+    else if (address < 0x4000)
+        SelectROMBank((value & 0x7F) == 0 ? 0x01 : value & 0x7F);
+    else if (address < 0x6000 && value <= 0x03)
+    {
+        _clockSelected = false;
+        SelectRAMBank(value);
+    }
+    else if (address < 0x6000 && value >= 0x08 && value <= 0x0C)
+        _clockSelected = true;
+
+    EnableRAM(_accessEnabled && !_clockSelected);
+}
+
+MBC5::MBC5(BankedMemoryResource* rom, BankedRAM* ram, size_t ramBankCount)
+    : CartridgeMemoryBankController(rom, ram, ramBankCount)
+{}
+
+// Unlike MBC1 and MBC3, bank 0 can be mapped into the switchable ROM window
+void MBC5::Write(uint16_t address, uint8_t value)
+{
+    if (address < 0x2000)
+        EnableRAM((value & 0x0F) == 0x0A);
+    else if (address < 0x3000)
+    {
+        _romBankNumber = static_cast<uint16_t>((_romBankNumber & 0x100) | value);
+        SelectROMBank(_romBankNumber);
+    }
+    else if (address < 0x4000)
+    {
+        _romBankNumber = static_cast<uint16_t>((_romBankNumber & 0xFF) | (value & 0x01) << 8);
+        SelectROMBank(_romBankNumber);
+    }
+    else if (address < 0x6000)
+        SelectRAMBank(value & 0x0F);
+}
+
+}
@@ -7,41 +7,383 @@ using namespace gbxcore::interfaces;
 namespace gbxcore::memory
 {
 
+MemoryController::MemoryController()
+{
+    _openBusPage.fill(0xFF);
+    BuildPageTables();
+    _activeView = &SelectView(_level);
+}
+
 std::variant<uint8_t, uint16_t> MemoryController::Read(size_t address, MemoryAccessType accessType)
 {
-    if (auto reg = IsRegisterAddress(address);
-        reg != SelectRegisterSource()->end())
+    if (accessType == MemoryAccessType::Byte)
+        return variant<uint8_t, uint16_t>{in_place_index<0>, ReadAt<MemoryAccessType::Byte>(*_activeView, address)};
+    else
+        return variant<uint8_t, uint16_t>{in_place_index<1>, ReadAt<MemoryAccessType::Word>(*_activeView, address)};
+}
+
+void MemoryController::Write(std::variant<uint8_t, uint16_t> value, size_t address)
+{
+    if (holds_alternative<uint8_t>(value))
+        WriteAt<MemoryAccessType::Byte>(*_activeView, get<uint8_t>(value), address);
+    else
+        WriteAt<MemoryAccessType::Word>(*_activeView, get<uint16_t>(value), address);
+}
+
+uint8_t MemoryController::ReadByte(size_t address)
+{
+    return ReadAt<MemoryAccessType::Byte>(*_activeView, address);
+}
+
+uint16_t MemoryController::ReadWord(size_t address)
+{
+    return ReadAt<MemoryAccessType::Word>(*_activeView, address);
+}
+
+void MemoryController::WriteByte(uint8_t value, size_t address)
+{
+    WriteAt<MemoryAccessType::Byte>(*_activeView, value, address);
+}
+
+void MemoryController::WriteWord(uint16_t value, size_t address)
+{
+    WriteAt<MemoryAccessType::Word>(*_activeView, value, address);
+}
+
+// Cross-domain reads (e.g. LDU) go through the view of the requested privilege level without switching the active one
+uint8_t MemoryController::ReadByteAs(PrivilegeMode mode, size_t address)
+{
+    if (_busMaster != nullptr && address < MemoryPageCount * MemoryPageSize && _lockedView.Pages[address / MemoryPageSize].Mapping == PageMapping::Locked) [[unlikely]]
+        if (BusHeld())
+            return 0xFF;
+
+    return ReadAt<MemoryAccessType::Byte>(SelectView(mode), address);
+}
+
+// Block transfers copy each run of contiguous direct memory at once. Anything else (registers, opaque resources,
+// read-only or unmapped pages) goes through the single byte path, with its usual register and fault handling.
+// The view is looked up again for every run, as a byte access may release (or a register write may take) the bus.
+void MemoryController::ReadBlock(size_t address, span<uint8_t> destination)
+{
+    for (auto position = 0llu; position < destination.size();)
     {
-        return reg->second.Register->Read();
+        auto& view = *_activeView;
+
+        if (auto run = DirectRun(view, address + position, destination.size() - position, false); run != 0)
+        {
+            memcpy(destination.data() + position, DirectData(view, address + position), run);
+            position += run;
+        }
+        else
+            destination[position++] = ReadAt<MemoryAccessType::Byte>(view, address + position);
     }
-    else
+}
+
+void MemoryController::WriteBlock(span<const uint8_t> source, size_t address)
+{
+    for (auto position = 0llu; position < source.size();)
     {
-        auto localAddress = CalculateLocalAddress(address);
-        auto& targetResource = *SelectResource();
-        if (localAddress == nullopt)
-            throw MemoryControllerException("requested address to write to does not fall into any resource");
+        auto& view = *_activeView;
 
-        return targetResource[localAddress.value().ResourceIndex].Resource.get()->Read(localAddress.value().LocalAddress, accessType);
+        if (auto run = DirectRun(view, address + position, source.size() - position, true); run != 0)
+        {
+            memcpy(DirectData(view, address + position), source.data() + position, run);
+            NotifyWrite(address + position, run);
+            position += run;
+        }
+        else
+        {
+            WriteAt<MemoryAccessType::Byte>(view, source[position], address + position);
+            ++position;
+        }
     }
 }
 
-void MemoryController::Write(std::variant<uint8_t, uint16_t> value, size_t address)
+void MemoryController::CopyBlock(size_t source, size_t destination, size_t size)
+{
+    CopyBlockThrough(false, source, destination, size);
+}
+
+// Bus masters (e.g. DMA) read and write through the view of the security level, never through the CPU's locked view
+void MemoryController::BusMasterCopyBlock(size_t source, size_t destination, size_t size)
 {
-    if (auto reg = IsRegisterAddress(address);
-        reg != SelectRegisterSource()->end())
+    CopyBlockThrough(true, source, destination, size);
+}
+
+inline MemoryView& MemoryController::TransferView(bool busMaster)
+{
+    return busMaster ? SelectView(_level) : *_activeView;
+}
+
+inline void MemoryController::CopyBlockThrough(bool busMaster, size_t source, size_t destination, size_t size)
+{
+    // Copying forward would overwrite source bytes not yet read, so overlapping copies run backwards one byte at a time
+    if (destination > source && destination < source + size) [[unlikely]]
     {
-        return reg->second.Register->Write(value);
+        for (auto position = size; position-- > 0;)
+            WriteAt<MemoryAccessType::Byte>(TransferView(busMaster), ReadAt<MemoryAccessType::Byte>(TransferView(busMaster), source + position), destination + position);
+
+        return;
     }
-    else
+
+    for (auto position = 0llu; position < size;)
     {
-        auto localAddress = CalculateLocalAddress(address);
-        auto& targetResource = *SelectResource();
+        auto& view = TransferView(busMaster);
+        auto run = min(DirectRun(view, source + position, size - position, false), DirectRun(view, destination + position, size - position, true));
 
-        if (localAddress == nullopt)
-            throw MemoryControllerException("requested address to read from does not fall into any resource");
+        if (run != 0)
+        {
+            memmove(DirectData(view, destination + position), DirectData(view, source + position), run);
+            NotifyWrite(destination + position, run);
+            position += run;
+        }
+        else
+        {
+            WriteAt<MemoryAccessType::Byte>(view, ReadAt<MemoryAccessType::Byte>(view, source + position), destination + position);
+            ++position;
+        }
+    }
+}
+
+bool MemoryController::HasSideEffects(size_t address)
+{
+    if (address >= MemoryPageCount * MemoryPageSize)
+        return FindRegister(*_activeView, address) != nullptr;
+
+    auto& page = _activeView->Pages[address / MemoryPageSize];
+    return (page.Registers && FindRegister(*_activeView, address) != nullptr) || page.BankControl || page.Mapping == PageMapping::Locked;
+}
+
+// Registers may react to reads, Fault pages report the access and Locked pages read as 0xFF while the bus is held
+bool MemoryController::IsPrefetchable(size_t address)
+{
+    if (address >= MemoryPageCount * MemoryPageSize)
+        return FindRegister(*_activeView, address) == nullptr && CalculateLocalAddress(*_activeView->Resources, address) != nullopt;
+
+    auto& page = _activeView->Pages[address / MemoryPageSize];
+    if (page.Registers && FindRegister(*_activeView, address) != nullptr)
+        return false;
+    else if (page.Mapping == PageMapping::Fragmented)
+        return CalculateLocalAddress(*_activeView->Resources, address) != nullopt;
+
+    return page.Mapping == PageMapping::Direct || page.Mapping == PageMapping::Resource;
+}
+
+// Registers are never poked, and read-only direct pages hold nothing a poke could restore
+void MemoryController::PokeByte(uint8_t value, size_t address)
+{
+    auto& view = SelectView(_level);
+
+    if (address < MemoryPageCount * MemoryPageSize)
+    {
+        auto& page = view.Pages[address / MemoryPageSize];
+        auto offset = address % MemoryPageSize;
 
-        targetResource[localAddress.value().ResourceIndex].Resource.get()->Write(value, localAddress.value().LocalAddress);
+        if (page.Registers && FindRegister(view, address) != nullptr)
+            return;
+        else if (page.Mapping == PageMapping::Direct)
+        {
+            if (page.Writable)
+                page.Data[offset] = value;
+
+            return;
+        }
+        else if (page.Mapping == PageMapping::Resource)
+        {
+            WriteTo<MemoryAccessType::Byte>(page.Resource, value, page.Offset + offset);
+            return;
+        }
+        else if (page.Mapping == PageMapping::Fault)
+            return;
+    }
+    else if (FindRegister(view, address) != nullptr)
+        return;
+
+    if (auto localAddress = CalculateLocalAddress(*view.Resources, address); localAddress != nullopt)
+        WriteTo<MemoryAccessType::Byte>((*view.Resources)[localAddress.value().ResourceIndex].Resource.get(), value, localAddress.value().LocalAddress);
+}
+
+// Length of the contiguous direct memory starting at the address, up to the given size (0 if the address is not direct)
+inline size_t MemoryController::DirectRun(MemoryView& view, size_t address, size_t size, bool write)
+{
+    size_t run = 0;
+    auto offset = address % MemoryPageSize;
+    uint8_t* next = nullptr;
+
+    for (auto page = address / MemoryPageSize; page < MemoryPageCount && run < size; ++page)
+    {
+        auto& entry = view.Pages[page];
+
+        if (entry.Mapping != PageMapping::Direct || entry.Registers || (write && !entry.Writable) || (next != nullptr && entry.Data != next))
+            break;
+
+        run += MemoryPageSize - offset;
+        next = entry.Data + MemoryPageSize;
+        offset = 0;
+    }
+
+    return min(run, size);
+}
+
+inline uint8_t* MemoryController::DirectData(MemoryView& view, size_t address)
+{
+    return view.Pages[address / MemoryPageSize].Data + address % MemoryPageSize;
+}
+
+template<MemoryAccessType AccessType>
+inline MemoryValue<AccessType> MemoryController::ReadAt(MemoryView& view, size_t address)
+{
+    if (address < MemoryPageCount * MemoryPageSize) [[likely]]
+    {
+        auto& pages = view.Pages;
+        auto& page = pages[address / MemoryPageSize];
+        auto offset = address % MemoryPageSize;
+
+        if (page.Registers) [[unlikely]]
+            if (auto reg = FindRegister(view, address); reg != nullptr)
+                return reg->ReadByte();
+
+        if (page.Mapping == PageMapping::Direct) [[likely]]
+        {
+            if constexpr (AccessType == MemoryAccessType::Byte)
+                return page.Data[offset];
+            else if (offset + 1 < MemoryPageSize)
+                return static_cast<uint16_t>(page.Data[offset + 1] << 8 | page.Data[offset]);
+            else if (auto pageIndex = address / MemoryPageSize; pageIndex + 1 < MemoryPageCount &&
+                     pages[pageIndex + 1].Mapping == PageMapping::Direct && pages[pageIndex + 1].Resource == page.Resource)
+                return static_cast<uint16_t>(pages[pageIndex + 1].Data[0] << 8 | page.Data[offset]);
+            else if (_faultPolicy != MemoryFaultPolicy::Throw)
+                return static_cast<uint16_t>(ReadAt<MemoryAccessType::Byte>(view, address + 1) << 8 | page.Data[offset]);
+        }
+
+        if (page.Mapping == PageMapping::Direct || page.Mapping == PageMapping::Resource)
+            return ReadFrom<AccessType>(page.Resource, page.Offset + offset);
+        else if (page.Mapping == PageMapping::Fault) [[unlikely]]
+            return static_cast<MemoryValue<AccessType>>(HandleFault(address, "requested address to write to does not fall into any resource"));
+        else if (page.Mapping == PageMapping::Locked) [[unlikely]]
+            return BusHeld() ? static_cast<MemoryValue<AccessType>>(0xFFFF) : ReadAt<AccessType>(*_activeView, address);
+    }
+    else if (auto reg = FindRegister(view, address); reg != nullptr)
+        return reg->ReadByte();
+
+    auto& targetResource = *view.Resources;
+    auto localAddress = CalculateLocalAddress(targetResource, address);
+    if (localAddress == nullopt) [[unlikely]]
+        return static_cast<MemoryValue<AccessType>>(HandleFault(address, "requested address to write to does not fall into any resource"));
+
+    return ReadFrom<AccessType>(targetResource[localAddress.value().ResourceIndex].Resource.get(), localAddress.value().LocalAddress);
+}
+
+template<MemoryAccessType AccessType>
+inline void MemoryController::WriteAt(MemoryView& view, MemoryValue<AccessType> value, size_t address)
+{
+    if (address < MemoryPageCount * MemoryPageSize) [[likely]]
+    {
+        auto& page = view.Pages[address / MemoryPageSize];
+        auto offset = address % MemoryPageSize;
+
+        if (page.Registers) [[unlikely]]
+            if (auto reg = FindRegister(view, address); reg != nullptr)
+                return reg->WriteByte(static_cast<uint8_t>(value & 0xFF));
+
+        if (page.Mapping == PageMapping::Direct && page.Writable) [[likely]]
+        {
+            if constexpr (AccessType == MemoryAccessType::Byte)
+            {
+                page.Data[offset] = value;
+                NotifyWrite(address);
+                return;
+            }
+            else if (offset + 1 < MemoryPageSize)
+            {
+                page.Data[offset] = value & 0xFF;
+                page.Data[offset + 1] = (value >> 8) & 0xFF;
+                NotifyWrite(address);
+                NotifyWrite(address + 1);
+                return;
+            }
+        }
+
+        if (page.Mapping == PageMapping::Fault) [[unlikely]]
+        {
+            HandleFault(address, "requested address to read from does not fall into any resource");
+            return;
+        }
+        else if (page.BankControl) [[unlikely]]
+        {
+            WriteBankControl<AccessType>(view, value, address);
+            return;
+        }
+        else if (page.Mapping == PageMapping::Locked) [[unlikely]]
+        {
+            if (!BusHeld())
+                WriteAt<AccessType>(*_activeView, value, address);
+
+            return;
+        }
+        else if (page.Mapping == PageMapping::Direct && !page.Writable) [[unlikely]]
+        {
+            HandleReadOnlyWrite(address);
+            return;
+        }
+        else if (page.Mapping == PageMapping::Direct || page.Mapping == PageMapping::Resource)
+        {
+            WriteTo<AccessType>(page.Resource, value, page.Offset + offset);
+            NotifyWrite(address);
+
+            if constexpr (AccessType == MemoryAccessType::Word)
+                NotifyWrite(address + 1);
+
+            return;
+        }
     }
+    else if (auto reg = FindRegister(view, address); reg != nullptr)
+        return reg->WriteByte(static_cast<uint8_t>(value & 0xFF));
+
+    auto& targetResource = *view.Resources;
+    auto localAddress = CalculateLocalAddress(targetResource, address);
+
+    if (localAddress == nullopt) [[unlikely]]
+    {
+        HandleFault(address, "requested address to read from does not fall into any resource");
+        return;
+    }
+
+    WriteTo<AccessType>(targetResource[localAddress.value().ResourceIndex].Resource.get(), value, localAddress.value().LocalAddress);
+    NotifyWrite(address);
+
+    if constexpr (AccessType == MemoryAccessType::Word)
+        NotifyWrite(address + 1);
+}
+
+// Bank switches only swap the data pointers of the pages of the switched resources; no resource lookup is involved
+template<MemoryAccessType AccessType>
+inline void MemoryController::WriteBankControl(MemoryView& view, MemoryValue<AccessType> value, size_t address)
+{
+    view.BankController->Write(static_cast<uint16_t>(address), static_cast<uint8_t>(value & 0xFF));
+
+    if constexpr (AccessType == MemoryAccessType::Word)
+        view.BankController->Write(static_cast<uint16_t>(address + 1), static_cast<uint8_t>(value >> 8));
+
+    RefreshBanks();
+}
+
+template<MemoryAccessType AccessType>
+inline MemoryValue<AccessType> MemoryController::ReadFrom(MemoryResource* resource, size_t localAddress)
+{
+    if constexpr (AccessType == MemoryAccessType::Byte)
+        return resource->ReadByte(localAddress);
+    else
+        return resource->ReadWord(localAddress);
+}
+
+template<MemoryAccessType AccessType>
+inline void MemoryController::WriteTo(MemoryResource* resource, MemoryValue<AccessType> value, size_t localAddress)
+{
+    if constexpr (AccessType == MemoryAccessType::Byte)
+        resource->WriteByte(value, localAddress);
+    else
+        resource->WriteWord(value, localAddress);
 }
 
 void MemoryController::Load(std::unique_ptr<uint8_t*> dataPointer, size_t size, size_t address, optional<size_t> offset)
@@ -53,6 +395,31 @@ void MemoryController::Load(std::unique_ptr<uint8_t*> dataPointer, size_t size,
         throw MemoryControllerException("requested address to load data to does not fall into any resource");
 
     targetResource[localAddress.value().ResourceIndex].Resource.get()->Load(std::move(dataPointer), size, offset);
+    BuildPageTables();
+    NotifyInvalidate();
+}
+
+void MemoryController::Map(shared_ptr<const uint8_t> content, size_t size, size_t address)
+{
+    auto localAddress = CalculateLocalAddress(address);
+    auto& targetResource = *SelectResource();
+
+    if (localAddress == nullopt)
+        throw MemoryControllerException("requested address to map data to does not fall into any resource");
+
+    auto mappable = dynamic_cast<MappableMemoryResource*>(targetResource[localAddress.value().ResourceIndex].Resource.get());
+
+    if (mappable == nullptr)
+    {
+        stringstream ss;
+        ss << "Memory region cotaining address '" << address << "' is not a mappable resource";
+        throw MemoryControllerException(ss.str());
+    }
+
+    // Mapping replaces the resource's backing memory, so the direct pages must be rebuilt
+    mappable->Map(std::move(content), size);
+    BuildPageTables();
+    NotifyInvalidate();
 }
 
 void MemoryController::SwitchBank(size_t address, size_t bank)
@@ -61,8 +428,11 @@ void MemoryController::SwitchBank(size_t address, size_t bank)
     
     // Test for Banked ROM or Banked RAM, otherwise, throw
     if (auto& targetResource = *SelectResource();
-        dynamic_cast<BankedROM*>(targetResource[localAddress.value().ResourceIndex].Resource.get()) != nullptr)
-        dynamic_cast<BankedROM*>(targetResource[localAddress.value().ResourceIndex].Resource.get())->SelectBank(bank);
+        targetResource[localAddress.value().ResourceIndex].Banked != nullptr)
+    {
+        targetResource[localAddress.value().ResourceIndex].Banked->SelectBank(bank);
+        RefreshBanks();
+    }
     else
     {
         stringstream ss;
@@ -74,6 +444,10 @@ void MemoryController::SwitchBank(size_t address, size_t bank)
 void MemoryController::SetSecurityLevel(gbxcore::SecurityLevel level)
 {
     _level = level;
+    _activeView = &SelectView(level);
+
+    if (_busMaster != nullptr) [[unlikely]]
+        BuildLockedView();
 }
 
 PrivilegeMode MemoryController::SecurityLevel()
@@ -81,6 +455,108 @@ PrivilegeMode MemoryController::SecurityLevel()
     return _level;
 }
 
+void MemoryController::SetFaultPolicy(MemoryFaultPolicy policy)
+{
+    _faultPolicy = policy;
+    BuildPageTables();
+}
+
+MemoryFaultPolicy MemoryController::FaultPolicy()
+{
+    return _faultPolicy;
+}
+
+void MemoryController::SetMemoryBankController(unique_ptr<interfaces::MemoryBankController> controller, PrivilegeMode owner)
+{
+    _bankController = std::move(controller);
+    _bankControllerOwner = owner;
+
+    // The controller may have selected its initial banks already
+    RefreshBanks();
+    BuildPageTables();
+}
+
+interfaces::MemoryBankController* MemoryController::BankController()
+{
+    return _bankController.get();
+}
+
+// The active view is swapped for a copy in which every page outside the accessible range is locked, so the CPU pays
+// nothing for the lock on the pages it can still reach. The lock is released lazily, by the first access to a locked
+// page once the bus master no longer holds the bus, unless the bus master releases it first.
+void MemoryController::LockBus(BusMaster* busMaster, AddressRange accessible)
+{
+    _busMaster = busMaster;
+    _busAccessibleRange = accessible;
+    BuildLockedView();
+}
+
+void MemoryController::ReleaseBus(BusMaster* busMaster)
+{
+    if (_busMaster == busMaster)
+        UnlockBus();
+}
+
+bool MemoryController::IsBusLocked()
+{
+    return _busMaster != nullptr && BusHeld();
+}
+
+// A locked view may still be in use by a block transfer after the lock was released
+inline bool MemoryController::BusHeld()
+{
+    if (_busMaster == nullptr)
+        return false;
+
+    if (_busMaster->HoldsBus())
+        return true;
+
+    UnlockBus();
+    return false;
+}
+
+inline void MemoryController::UnlockBus()
+{
+    _busMaster = nullptr;
+    _busAccessibleRange.reset();
+    _activeView = &SelectView(_level);
+}
+
+inline void MemoryController::BuildLockedView()
+{
+    auto& accessible = _busAccessibleRange.value();
+    auto firstPage = accessible.Begin() / MemoryPageSize;
+    auto lastPage = min(accessible.End() / MemoryPageSize, MemoryPageCount - 1);
+
+    _lockedView = SelectView(_level);
+
+    for (auto page = 0llu; page < MemoryPageCount; ++page)
+        if (page < firstPage || page > lastPage)
+            _lockedView.Pages[page] = {.Data = nullptr, .Resource = nullptr, .Offset = 0, .Mapping = PageMapping::Locked, .Writable = false, .Registers = false, .BankControl = false};
+
+    _activeView = &_lockedView;
+}
+
+// Faults are kept out of line so that the access paths carry no error handling. Under the Log and OpenBus
+// policies faulting reads return 0xFF and faulting writes are dropped.
+uint16_t MemoryController::HandleFault(size_t address, const char* reason)
+{
+    if (_faultPolicy == MemoryFaultPolicy::Throw)
+        throw MemoryControllerException(reason);
+    else if (_faultPolicy == MemoryFaultPolicy::Log)
+        cerr << "[MemoryController] " << reason << " (address " << address << ")\n";
+
+    return 0xFFFF;
+}
+
+void MemoryController::HandleReadOnlyWrite(size_t address)
+{
+    if (_faultPolicy == MemoryFaultPolicy::Throw)
+        throw MemoryAccessException("Attempted to write to a read-only resource");
+    else if (_faultPolicy == MemoryFaultPolicy::Log)
+        cerr << "[MemoryController] attempted to write to a read-only resource (address " << address << ")\n";
+}
+
 size_t MemoryController::RegisterMemoryResource(std::unique_ptr<MemoryResource> resource, AddressRange range, PrivilegeMode owner)
 {
     auto oldMode = SecurityLevel();
@@ -89,11 +565,16 @@ size_t MemoryController::RegisterMemoryResource(std::unique_ptr<MemoryResource>
         DetectOverlap(range);
         DetectMisfit(resource.get(), range);
 
+        // Banked resources are resolved once here, so that switching banks needs no type lookup
         auto targetID = _resourcesID++;
-        SelectResource()->push_back({std::move(resource), range, targetID});
+        auto banked = dynamic_cast<BankedMemoryResource*>(resource.get());
+        auto direct = dynamic_cast<DirectMemoryResource*>(resource.get());
+        SelectResource()->push_back({std::move(resource), range, targetID, banked, direct, nullptr, banked != nullptr ? banked->CurrentBank() : 0});
         SortResources();
     
     SetSecurityLevel(oldMode);
+    BuildPageTables();
+    NotifyInvalidate();
     return targetID;
 }
 
@@ -111,6 +592,8 @@ void MemoryController::UnregisterMemoryResource(size_t id, PrivilegeMode owner)
             targetResource[i].Resource.release();
             targetResource.erase(begin(targetResource) + i);
             SetSecurityLevel(oldMode);
+            BuildPageTables();
+            NotifyInvalidate();
             return;
         }
     }
@@ -142,13 +625,18 @@ void MemoryController::RegisterMemoryMappedRegister(unique_ptr<MemoryMappedRegis
         ss << "Register '" << address << "' has already been registered";
         throw MemoryControllerException(ss.str());
     }
+
+    BuildPageTables();
 }
 
 void MemoryController::UnregisterMemoryMappedRegister(size_t address, PrivilegeMode owner)
 {
     if (auto reg = GetRegisterSource(owner)->find(address);
         reg != GetRegisterSource(owner)->end())
+    {
         GetRegisterSource(owner)->erase(reg);
+        BuildPageTables();
+    }
     else
     {
         stringstream ss;
@@ -157,6 +645,40 @@ void MemoryController::UnregisterMemoryMappedRegister(size_t address, PrivilegeM
     }
 }
 
+void MemoryController::RegisterMemoryObserver(MemoryObserver* observer)
+{
+    if (find(begin(_observers), end(_observers), observer) == end(_observers))
+        _observers.push_back(observer);
+}
+
+void MemoryController::UnregisterMemoryObserver(MemoryObserver* observer)
+{
+    if (auto position = find(begin(_observers), end(_observers), observer);
+        position != end(_observers))
+        _observers.erase(position);
+    else
+        throw MemoryControllerException("the observer to be unregistered could not be found");
+}
+
+inline void MemoryController::NotifyWrite(size_t address)
+{
+    for (auto observer : _observers)
+        observer->OnWrite(address);
+}
+
+inline void MemoryController::NotifyWrite(size_t address, size_t size)
+{
+    for (auto observer : _observers)
+        for (auto offset = 0llu; offset < size; ++offset)
+            observer->OnWrite(address + offset);
+}
+
+inline void MemoryController::NotifyInvalidate()
+{
+    for (auto observer : _observers)
+        observer->OnInvalidate();
+}
+
 inline void MemoryController::DetectMisfit(MemoryResource* resource, AddressRange range)
 {
     if (range.End() - range.Begin() + 1 != resource->Size())
@@ -179,17 +701,20 @@ inline void MemoryController::DetectOverlap(AddressRange range)
 {
     auto& targetResource = *SelectResource();
     
-    for (auto& [_resource, _range, _id] : targetResource)
+    for (auto& registered : targetResource)
     {
-        if (range.Begin() < _range.End() && _range.Begin() < range.End())
+        if (range.Begin() < registered.Range.End() && registered.Range.Begin() < range.End())
             throw MemoryControllerException("ranges overlap");
     }
 }
 
 std::optional<ResourceIndexAndAddress> MemoryController::CalculateLocalAddress(size_t address)
 {
-    auto& targetResource = *SelectResource();
+    return CalculateLocalAddress(*SelectResource(), address);
+}
 
+std::optional<ResourceIndexAndAddress> MemoryController::CalculateLocalAddress(vector<RegisteredMemoryResource>& targetResource, size_t address)
+{
     // TODO: Optimize this later
     for (auto i = static_cast<size_t>(0); i < targetResource.size(); i++)
     {
@@ -206,20 +731,7 @@ std::optional<ResourceIndexAndAddress> MemoryController::CalculateLocalAddress(s
 
 inline std::vector<RegisteredMemoryResource>* MemoryController::SelectResource()
 {
-    if (_level == PrivilegeMode::System)
-        return &_systemResources;
-    else
-        return &_userResources;
-}
-
-inline std::map<uint16_t, RegisteredMemoryMappedRegister>* MemoryController::SelectRegisterSource()
-{
-    if (_level == PrivilegeMode::System)
-        return &_systemRegisters;
-    else if (_level == PrivilegeMode::User)
-        return &_userRegisters;
-    else
-        return &_bothRegisters;
+    return _activeView->Resources;
 }
 
 inline std::map<uint16_t, RegisteredMemoryMappedRegister>* MemoryController::GetRegisterSource(PrivilegeMode owner)
@@ -232,17 +744,160 @@ inline std::map<uint16_t, RegisteredMemoryMappedRegister>* MemoryController::Get
         return &_bothRegisters;
 }
 
-
-inline std::map<uint16_t, RegisteredMemoryMappedRegister>::iterator MemoryController::IsRegisterAddress(size_t address)
+inline MemoryMappedRegister* MemoryController::FindRegister(MemoryView& view, size_t address)
 {
+    if (static_cast<uint16_t>(address) / MemoryPageSize == IORegisterPage)
+        return view.IORegisters[address % MemoryPageSize];
+
     if (auto position = _bothRegisters.find(address);
         position != _bothRegisters.end())
-        return position;
+        return position->second.Register.get();
+
+    if (auto position = view.Registers->find(address);
+        position != view.Registers->end())
+        return position->second.Register.get();
+
+    return nullptr;
+}
+
+inline MemoryView& MemoryController::SelectView(PrivilegeMode mode)
+{
+    return _views[static_cast<size_t>(mode)];
+}
+
+// The Both view resolves like the User view, which is what a Both security level has always addressed
+inline void MemoryController::BuildPageTables()
+{
+    auto systemController = _bankControllerOwner != PrivilegeMode::User ? _bankController.get() : nullptr;
+    auto userController = _bankControllerOwner != PrivilegeMode::System ? _bankController.get() : nullptr;
 
-    if (_level == PrivilegeMode::System)
-        return _systemRegisters.find(address);
+    BuildView(SelectView(PrivilegeMode::System), _systemResources, _systemRegisters, systemController);
+    BuildView(SelectView(PrivilegeMode::User), _userResources, _userRegisters, userController);
+    BuildView(SelectView(PrivilegeMode::Both), _userResources, _userRegisters, userController);
+
+    _bankedResources.clear();
+
+    for (auto [resources, owner] : {make_pair(&_systemResources, PrivilegeMode::System), make_pair(&_userResources, PrivilegeMode::User)})
+        for (auto& registered : *resources)
+            if (registered.Banked != nullptr)
+                _bankedResources.push_back({&registered, owner});
+
+    if (_busMaster != nullptr) [[unlikely]]
+        BuildLockedView();
+}
+
+inline void MemoryController::BuildView(MemoryView& view, vector<RegisteredMemoryResource>& resources, map<uint16_t, RegisteredMemoryMappedRegister>& registers, interfaces::MemoryBankController* bankController)
+{
+    auto& pages = view.Pages;
+    auto& ioRegisters = view.IORegisters;
+    view.Resources = &resources;
+    view.Registers = &registers;
+    view.BankController = bankController;
+
+    if (_faultPolicy == MemoryFaultPolicy::OpenBus)
+        pages.fill({.Data = _openBusPage.data(), .Resource = nullptr, .Offset = 0, .Mapping = PageMapping::Direct, .Writable = false, .Registers = false, .BankControl = false});
     else
-        return _userRegisters.find(address);    
+        pages.fill({.Data = nullptr, .Resource = nullptr, .Offset = 0, .Mapping = PageMapping::Fault, .Writable = false, .Registers = false, .BankControl = false});
+
+    for (auto& registered : resources)
+    {
+        auto data = registered.Direct != nullptr ? registered.Direct->Data() : nullptr;
+        auto& range = registered.Range;
+        auto lastPage = min(range.End() / MemoryPageSize, MemoryPageCount - 1);
+
+        registered.MappedData = data;
+        registered.MappedBank = registered.Banked != nullptr ? registered.Banked->CurrentBank() : 0;
+
+        for (auto page = range.Begin() / MemoryPageSize; page <= lastPage; ++page)
+        {
+            auto pageBegin = page * MemoryPageSize;
+            auto& entry = pages[page];
+
+            if (entry.Resource != nullptr || entry.Mapping == PageMapping::Fragmented || range.Begin() > pageBegin || range.End() < pageBegin + MemoryPageSize - 1)
+            {
+                entry.Mapping = PageMapping::Fragmented;
+                continue;
+            }
+
+            auto offset = pageBegin - range.Begin();
+            auto direct = data != nullptr && offset + MemoryPageSize <= registered.Resource->Size();
+
+            entry.Resource = registered.Resource.get();
+            entry.Offset = offset;
+            entry.Mapping = direct ? PageMapping::Direct : PageMapping::Resource;
+            entry.Data = direct ? data + offset : nullptr;
+            entry.Writable = direct && registered.Direct->IsWritable();
+        }
+    }
+
+    if (bankController != nullptr)
+    {
+        auto controlRange = bankController->ControlRange();
+        auto lastPage = min(controlRange.End() / MemoryPageSize, MemoryPageCount - 1);
+
+        for (auto page = controlRange.Begin() / MemoryPageSize; page <= lastPage; ++page)
+            pages[page].BankControl = true;
+    }
+
+    ioRegisters.fill(nullptr);
+
+    for (auto source : {&registers, &_bothRegisters})
+    {
+        for (auto& [address, reg] : *source)
+        {
+            pages[(address / MemoryPageSize) % MemoryPageCount].Registers = true;
+
+            if (address / MemoryPageSize == IORegisterPage)
+                ioRegisters[address % MemoryPageSize] = reg.Register.get();
+        }
+    }
+}
+
+inline void MemoryController::RefreshBanks()
+{
+    for (auto [registered, owner] : _bankedResources)
+    {
+        if (auto bank = registered->Banked->CurrentBank(); bank != registered->MappedBank)
+        {
+            registered->MappedBank = bank;
+
+            for (auto observer : _observers)
+                observer->OnBankSwitch(owner, registered->Range, bank);
+        }
+
+        if (registered->Direct != nullptr && registered->Direct->Data() != registered->MappedData)
+            RemapPages(*registered);
+    }
+}
+
+inline void MemoryController::RemapPages(RegisteredMemoryResource& registered)
+{
+    auto data = registered.Direct->Data();
+    auto writable = registered.Direct->IsWritable();
+    auto size = registered.Resource->Size();
+    auto lastPage = min(registered.Range.End() / MemoryPageSize, MemoryPageCount - 1);
+
+    registered.MappedData = data;
+
+    for (auto& view : _views)
+    {
+        for (auto page = registered.Range.Begin() / MemoryPageSize; page <= lastPage; ++page)
+        {
+            auto& entry = view.Pages[page];
+
+            if (entry.Resource != registered.Resource.get() || entry.Mapping == PageMapping::Fragmented)
+                continue;
+
+            auto direct = data != nullptr && entry.Offset + MemoryPageSize <= size;
+
+            entry.Mapping = direct ? PageMapping::Direct : PageMapping::Resource;
+            entry.Data = direct ? data + entry.Offset : nullptr;
+            entry.Writable = direct && writable;
+        }
+    }
+
+    if (_busMaster != nullptr) [[unlikely]]
+        BuildLockedView();
 }
 
 }
\ No newline at end of file
@@ -9,38 +9,42 @@ RAM::RAM(size_t size)
     : ROM(size)
 {}
     
-void RAM::Write(variant<uint8_t, uint16_t> value, size_t address)
+void RAM::WriteByte(uint8_t value, size_t address)
 {
-    CheckWriteConditions(value, address);
+    CheckWriteConditions<MemoryAccessType::Byte>(address);
+    _data[address] = value;
+}
 
-    if (holds_alternative<uint8_t>(value))
-    {
-        auto byte = get<uint8_t>(value);
-        _rom[address] = byte & 0xFF;
-    }
-    else if (holds_alternative<uint16_t>(value))
-    {
-        auto word = get<uint16_t>(value);
-        _rom[address] = word & 0xFF;
-        _rom[address + 1] = (word >> 8) & 0xFF;
-    }
-    else
-        throw MemoryAccessException("variant has no value.");
+void RAM::WriteWord(uint16_t value, size_t address)
+{
+    CheckWriteConditions<MemoryAccessType::Word>(address);
+    _data[address] = value & 0xFF;
+    _data[address + 1] = (value >> 8) & 0xFF;
 }
 
-inline void RAM::CheckWriteConditions(std::variant<uint8_t, uint16_t> value, size_t address)
+// RAM is written to, so mapped content is always copied into its own storage
+void RAM::Map(shared_ptr<const uint8_t> content, size_t size)
 {
-    if (holds_alternative<uint8_t>(value) && address >= _size)
+    CopyFrom(content.get(), size);
+}
+
+bool RAM::IsWritable()
+{
+    return true;
+}
+
+template<MemoryAccessType AccessType>
+inline void RAM::CheckWriteConditions(size_t address)
+{
+    if constexpr (AccessType == MemoryAccessType::Byte)
     {
-        stringstream ss;
-        ss << "bad memory address when writing byte to (" << address << " out of " << _size << ")";
-        throw MemoryAccessException(ss.str());
+        if (address >= _size) [[unlikely]]
+            ThrowBadAddress("writing byte to", address);
     }
-    else if (holds_alternative<uint16_t>(value) && (address >= _size || address + 1 >= _size))
+    else
     {
-        stringstream ss;
-        ss << "bad memory address when writing word to (" << address << " out of " << _size << ")";
-        throw MemoryAccessException(ss.str());
+        if (address + 1 >= _size) [[unlikely]]
+            ThrowBadAddress("writing word to", address);
     }
 }
 
@@ -8,10 +8,9 @@ namespace gbxcore::memory
 
 ROM::ROM(std::size_t sizeInBytes)
     : _size(sizeInBytes)
-    , _rom(new uint8_t[sizeInBytes])
-{
-    fill(&_rom.get()[0], &_rom.get()[_size], 0x00);
-}
+    , _rom(AllocateZeroPages<uint8_t>(sizeInBytes))
+    , _data(_rom.get())
+{}
 
 size_t ROM::Size()
 {
@@ -27,38 +26,105 @@ void ROM::Load(shared_ptr<uint8_t*> content, size_t size, optional<size_t> offse
         throw MemoryAccessException(ss.str());
     }
 
-    copy(&(*content)[0], &(*content)[size], &_rom.get()[offset.value_or(0)]);
+    Materialize();
+    copy(&(*content)[0], &(*content)[size], &_data[offset.value_or(0)]);
+}
+
+// Content covering the whole ROM is used in place and the owned copy is released. Shorter content cannot back the
+// ROM by itself and is copied instead.
+void ROM::Map(shared_ptr<const uint8_t> content, size_t size)
+{
+    if (size < _size)
+    {
+        CopyFrom(content.get(), size);
+        return;
+    }
+
+    // Mapped content is never written to: ROM rejects writes and IsWritable keeps it off the controller's write path
+    _mapping = std::move(content);
+    _data = const_cast<uint8_t*>(_mapping.get());
+    _rom.reset();
 }
 
-std::variant<uint8_t, uint16_t> ROM::Read(size_t address, MemoryAccessType accessType)
+void ROM::CopyFrom(const uint8_t* content, size_t size)
 {
-    CheckReadConditions(address, accessType);
+    auto copySize = min(size, _size);
 
-    if (accessType == MemoryAccessType::Byte)
-        return variant<uint8_t, uint16_t>{in_place_index<0>, _rom[address]};
+    // Fresh storage is already zeroed, so only a reused buffer needs its tail cleared
+    if (_mapping != nullptr || _rom == nullptr)
+    {
+        _rom = AllocateZeroPages<uint8_t>(_size);
+        _mapping.reset();
+        _data = _rom.get();
+    }
     else
-        return variant<uint8_t, uint16_t>{in_place_index<1>, (_rom[address + 1] << 8 | _rom[address])};
+        fill(_data + copySize, _data + _size, 0x00);
+
+    copy(content, content + copySize, _data);
+}
+
+// Gives a mapped ROM its own copy of the mapped content before it is modified
+void ROM::Materialize()
+{
+    if (_mapping == nullptr)
+        return;
+
+    auto mapping = _mapping;
+    CopyFrom(mapping.get(), _size);
 }
 
-void ROM::Write([[maybe_unused]] std::variant<uint8_t, uint16_t> value, [[maybe_unused]] size_t address)
+uint8_t* ROM::Data()
+{
+    return _data;
+}
+
+bool ROM::IsWritable()
+{
+    return false;
+}
+
+uint8_t ROM::ReadByte(size_t address)
+{
+    CheckReadConditions<MemoryAccessType::Byte>(address);
+    return _data[address];
+}
+
+uint16_t ROM::ReadWord(size_t address)
+{
+    CheckReadConditions<MemoryAccessType::Word>(address);
+    return static_cast<uint16_t>(_data[address + 1] << 8 | _data[address]);
+}
+
+void ROM::WriteByte([[maybe_unused]] uint8_t value, [[maybe_unused]] size_t address)
 {
     throw MemoryAccessException("Attempted to write to a read-only resource");
 }
 
-inline void ROM::CheckReadConditions(size_t address, MemoryAccessType accessType)
+void ROM::WriteWord([[maybe_unused]] uint16_t value, [[maybe_unused]] size_t address)
 {
-    if (address >= _size && accessType == MemoryAccessType::Byte)
+    throw MemoryAccessException("Attempted to write to a read-only resource");
+}
+
+template<MemoryAccessType AccessType>
+inline void ROM::CheckReadConditions(size_t address)
+{
+    if constexpr (AccessType == MemoryAccessType::Byte)
     {
-        stringstream ss;
-        ss << "bad memory address when reading byte from (" << address << " out of " << _size << ")";
-        throw MemoryAccessException(ss.str());
+        if (address >= _size) [[unlikely]]
+            ThrowBadAddress("reading byte from", address);
     }
-    else if ((address >= _size || address + 1 >= _size) && accessType == MemoryAccessType::Word)
+    else
     {
-        stringstream ss;
-        ss << "bad memory address when reading word from (" << address << " out of " << _size << ")";
-        throw MemoryAccessException(ss.str());
+        if (address + 1 >= _size) [[unlikely]]
+            ThrowBadAddress("reading word from", address);
     }
 }
 
+void ROM::ThrowBadAddress(const char* access, size_t address)
+{
+    stringstream ss;
+    ss << "bad memory address when " << access << " (" << address << " out of " << _size << ")";
+    throw MemoryAccessException(ss.str());
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include "ROMImageRegistry.h"
+
+using namespace std;
+
+namespace gbxcore::memory
+{
+
+ROMImageRegistry& ROMImageRegistry::Instance()
+{
+    static ROMImageRegistry registry;
+    return registry;
+}
+
+ROMImage ROMImageRegistry::Acquire(shared_ptr<const uint8_t> content, size_t size, size_t granularity)
+{
+    auto key = make_tuple(Hash(content.get(), size), size, granularity);
+    lock_guard<mutex> guard(_imagesMutex);
+
+    // Equal hashes are confirmed against the content, so a collision only costs a private image
+    if (auto entry = _images.find(key); entry != _images.end())
+    {
+        if (auto data = entry->second.Data.lock();
+            data != nullptr && memcmp(data.get(), content.get(), entry->second.ContentSize) == 0)
+            return {data, entry->second.Size};
+    }
+
+    auto image = CreateImage(std::move(content), size, granularity);
+    _images[key] = {image.Data, image.Size, size};
+
+    for (auto entry = begin(_images); entry != end(_images);)
+        entry = entry->second.Data.expired() ? _images.erase(entry) : next(entry);
+
+    return image;
+}
+
+size_t ROMImageRegistry::Count()
+{
+    lock_guard<mutex> guard(_imagesMutex);
+    return count_if(begin(_images), end(_images), [](auto& entry) { return !entry.second.Data.expired(); });
+}
+
+// 64-bit FNV-1a
+uint64_t ROMImageRegistry::Hash(const uint8_t* content, size_t size)
+{
+    auto hash = static_cast<uint64_t>(0xCBF29CE484222325);
+
+    for (auto i = static_cast<size_t>(0); i < size; ++i)
+        hash = (hash ^ content[i]) * static_cast<uint64_t>(0x100000001B3);
+
+    return hash;
+}
+
+inline ROMImage ROMImageRegistry::CreateImage(shared_ptr<const uint8_t> content, size_t size, size_t granularity)
+{
+    auto imageSize = granularity == 0 ? size : max(granularity, (size + granularity - 1) / granularity * granularity);
+
+    if (imageSize == size)
+        return {std::move(content), size};
+
+    // Content that does not fill its last granule is copied once into a padded image
+    shared_ptr<uint8_t[]> padded(new uint8_t[imageSize]);
+    copy(content.get(), content.get() + size, padded.get());
+    fill(padded.get() + size, padded.get() + imageSize, 0x00);
+
+    return {shared_ptr<const uint8_t>(padded, padded.get()), imageSize};
+}
+
+}
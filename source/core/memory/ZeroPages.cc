@@ -0,0 +1,43 @@
+#include "ZeroPages.h"
+
+#include <cstdlib>
+#include <sys/mman.h>
+
+namespace gbxcore::memory
+{
+
+void* AllocateZeroedBytes(size_t size)
+{
+    if (size == 0)
+        return nullptr;
+
+    if (size >= ZeroPagesMappingThreshold)
+    {
+        auto mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (mapping == MAP_FAILED)
+            throw std::bad_alloc();
+
+        return mapping;
+    }
+
+    auto block = calloc(1, size);
+
+    if (block == nullptr)
+        throw std::bad_alloc();
+
+    return block;
+}
+
+void ZeroPagesDeleter::operator()(void* block) const
+{
+    if (block == nullptr)
+        return;
+
+    if (Size >= ZeroPagesMappingThreshold)
+        munmap(block, Size);
+    else
+        free(block);
+}
+
+}
@@ -11,9 +11,9 @@ CGBBackgroundPaletteDataRegister::CGBBackgroundPaletteDataRegister(gbxcore::inte
     : _videoController(videoController)
 {}
 
-void CGBBackgroundPaletteDataRegister::Write(std::variant<uint8_t, uint16_t> value)
+void CGBBackgroundPaletteDataRegister::WriteByte(uint8_t value)
 {
-    _value = Extract8BitValue(value);
+    _value = value;
     _videoController->RegisterCGBBackgroundPaletteColorByte(_currentColorIndex, _value);
     _indexRegisterReference->ReportDataWrite();
 }
@@ -11,9 +11,9 @@ CGBBackgroundPaletteIndexRegister::CGBBackgroundPaletteIndexRegister(gbxcore::in
     : _videoController(videoController)
 {}
 
-void CGBBackgroundPaletteIndexRegister::Write(std::variant<uint8_t, uint16_t> value)
+void CGBBackgroundPaletteIndexRegister::WriteByte(uint8_t value)
 {
-    _value = Extract8BitValue(value);
+    _value = value;
     
     if ((_value & 0x7F) >= 0x40)
         _value = (_value & 0x80) | 0x00;
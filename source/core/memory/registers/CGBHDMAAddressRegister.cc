@@ -0,0 +1,16 @@
+#include "CGBHDMAAddressRegister.h"
+
+namespace gbxcore::memory::registers
+{
+
+uint8_t CGBHDMAAddressRegister::ReadByte()
+{
+    return 0xFF;
+}
+
+uint8_t CGBHDMAAddressRegister::Value()
+{
+    return _value;
+}
+
+}
@@ -0,0 +1,98 @@
+#include "CGBHDMAControlRegister.h"
+
+using namespace gbxcore::constants;
+using namespace gbxcore::interfaces;
+using namespace std;
+
+namespace gbxcore::memory::registers
+{
+
+CGBHDMAControlRegister::CGBHDMAControlRegister(MemoryController* controller, CycleStall stall)
+    : _memoryController(controller)
+    , _stall(stall)
+{
+    _value = 0xFF;
+}
+
+void CGBHDMAControlRegister::RegisterAddressRegisters(CGBHDMAAddressRegister* sourceHigh, CGBHDMAAddressRegister* sourceLow, CGBHDMAAddressRegister* destinationHigh, CGBHDMAAddressRegister* destinationLow)
+{
+    _sourceHighRegisterReference = sourceHigh;
+    _sourceLowRegisterReference = sourceLow;
+    _destinationHighRegisterReference = destinationHigh;
+    _destinationLowRegisterReference = destinationLow;
+}
+
+// Bit 7 reads 0 while an HBlank transfer is running, and the lower bits hold the number of blocks left minus one
+uint8_t CGBHDMAControlRegister::ReadByte()
+{
+    if (_hblankTransferActive)
+        return static_cast<uint8_t>(_remainingBlocks - 1);
+
+    return _value;
+}
+
+void CGBHDMAControlRegister::WriteByte(uint8_t value)
+{
+    auto blocks = static_cast<size_t>(value & 0x7F) + 1;
+
+    // Clearing bit 7 while an HBlank transfer is running stops it, leaving the blocks that were not copied
+    if (_hblankTransferActive && (value & 0x80) == 0)
+    {
+        _hblankTransferActive = false;
+        _value = static_cast<uint8_t>(0x80 | (_remainingBlocks - 1));
+        return;
+    }
+
+    LoadAddresses();
+
+    if ((value & 0x80) != 0)
+    {
+        _remainingBlocks = blocks;
+        _hblankTransferActive = true;
+        return;
+    }
+
+    TransferBlocks(blocks);
+    _value = 0xFF;
+}
+
+void CGBHDMAControlRegister::OnHBlank()
+{
+    if (!_hblankTransferActive)
+        return;
+
+    TransferBlocks(1);
+
+    if (--_remainingBlocks == 0)
+    {
+        _hblankTransferActive = false;
+        _value = 0xFF;
+    }
+}
+
+bool CGBHDMAControlRegister::IsHBlankTransferActive()
+{
+    return _hblankTransferActive;
+}
+
+// The lower four bits of both addresses are ignored; the destination always falls in VRAM
+inline void CGBHDMAControlRegister::LoadAddresses()
+{
+    _source = static_cast<size_t>(_sourceHighRegisterReference->Value() << 8 | _sourceLowRegisterReference->Value()) & 0xFFF0;
+    _destination = DMGBCVideoRAMInitialAddress + (static_cast<size_t>(_destinationHighRegisterReference->Value() << 8 | _destinationLowRegisterReference->Value()) & 0x1FF0);
+}
+
+// Consecutive blocks are moved with a single bulk copy. Blocks past the end of VRAM are dropped.
+inline void CGBHDMAControlRegister::TransferBlocks(size_t blocks)
+{
+    size_t size = _destination < DMGBCVideoRAMFinalAddress ? min(blocks * CGBVideoRAMDMABlockSize, DMGBCVideoRAMFinalAddress - _destination) : 0;
+
+    if (size != 0)
+        _memoryController->BusMasterCopyBlock(_source, _destination, size);
+
+    _source += blocks * CGBVideoRAMDMABlockSize;
+    _destination += blocks * CGBVideoRAMDMABlockSize;
+    _stall(blocks * CGBVideoRAMDMABlockCycles);
+}
+
+}
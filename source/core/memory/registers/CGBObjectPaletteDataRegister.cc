@@ -11,9 +11,9 @@ CGBObjectPaletteDataRegister::CGBObjectPaletteDataRegister(gbxcore::interfaces::
     : _videoController(videoController)
 {}
 
-void CGBObjectPaletteDataRegister::Write(std::variant<uint8_t, uint16_t> value)
+void CGBObjectPaletteDataRegister::WriteByte(uint8_t value)
 {
-    _value = Extract8BitValue(value);
+    _value = value;
     _videoController->RegisterCGBObjectPaletteColorByte(_currentColorIndex, _value);
     _indexRegisterReference->ReportDataWrite();
 }
@@ -9,9 +9,9 @@ DMGBackgroundPalleteRegister::DMGBackgroundPalleteRegister(gbxcore::interfaces::
     : _videoController(videoController)
 {}
 
-void DMGBackgroundPalleteRegister::Write(std::variant<uint8_t, uint16_t> value)
+void DMGBackgroundPalleteRegister::WriteByte(uint8_t value)
 {
-    _value = Extract8BitValue(value);
+    _value = value;
     
     _videoController->RegisterDMGBackgroundPaletteColor(_value & 0x03, PaletteColor::Color0);
     _videoController->RegisterDMGBackgroundPaletteColor((_value >> 0x02) & 0x03, PaletteColor::Color1);
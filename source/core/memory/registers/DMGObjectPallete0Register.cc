@@ -9,9 +9,9 @@ DMGObjectPallete0Register::DMGObjectPallete0Register(gbxcore::interfaces::VideoC
     : _videoController(videoController)
 {}
 
-void DMGObjectPallete0Register::Write(std::variant<uint8_t, uint16_t> value)
+void DMGObjectPallete0Register::WriteByte(uint8_t value)
 {
-    _value = Extract8BitValue(value);
+    _value = value;
     
     _videoController->RegisterDMGObjectPaletteColor(_value & 0x03, DMGPalette::Palette0, PaletteColor::Color0);
     _videoController->RegisterDMGObjectPaletteColor((_value >> 0x02) & 0x03, DMGPalette::Palette0, PaletteColor::Color1);
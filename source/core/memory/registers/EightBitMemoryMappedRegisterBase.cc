@@ -10,14 +10,14 @@ size_t EightBitMemoryMappedRegisterBase::Size()
     return 1;
 }
 
-std::variant<uint8_t, uint16_t> EightBitMemoryMappedRegisterBase::Read()
+uint8_t EightBitMemoryMappedRegisterBase::ReadByte()
 {
     return _value;
 }
 
-void EightBitMemoryMappedRegisterBase::Write(std::variant<uint8_t, uint16_t> value)
+void EightBitMemoryMappedRegisterBase::WriteByte(uint8_t value)
 {
-    _value = Extract8BitValue(value);
+    _value = value;
 }
 
 }
\ No newline at end of file
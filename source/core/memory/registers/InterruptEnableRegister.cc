@@ -11,17 +11,14 @@ size_t InterruptEnableRegister::Size()
     return 1llu;
 }
 
-variant<uint8_t, uint16_t> InterruptEnableRegister::Read()
+uint8_t InterruptEnableRegister::ReadByte()
 {
     return _value;
 }
 
-void InterruptEnableRegister::Write(variant<uint8_t, uint16_t> value)
+void InterruptEnableRegister::WriteByte(uint8_t value)
 {
-    if (holds_alternative<uint16_t>(value))
-        _value = get<uint16_t>(value) & 0xFF;
-    else
-        _value = get<uint8_t>(value);
+    _value = value;
 }
 
 }
\ No newline at end of file
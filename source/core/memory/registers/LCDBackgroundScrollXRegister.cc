@@ -10,9 +10,9 @@ LCDBackgroundScrollXRegister::LCDBackgroundScrollXRegister(VideoControllerInterf
     : _videoController(controller)
 {}
 
-void LCDBackgroundScrollXRegister::Write(variant<uint8_t, uint16_t> value)
+void LCDBackgroundScrollXRegister::WriteByte(uint8_t value)
 {
-    _value = Extract8BitValue(value);
+    _value = value;
     _videoController->ScrollBackgroundX(_value);
 }
 
@@ -10,9 +10,9 @@ LCDBackgroundScrollYRegister::LCDBackgroundScrollYRegister(VideoControllerInterf
     : _videoController(controller)
 {}
      
-void LCDBackgroundScrollYRegister::Write(variant<uint8_t, uint16_t> value)
+void LCDBackgroundScrollYRegister::WriteByte(uint8_t value)
 {
-    _value = Extract8BitValue(value);
+    _value = value;
     _videoController->ScrollBackgroundY(_value);
 }
 
@@ -11,11 +11,11 @@ LCDControlRegister::LCDControlRegister(VideoControllerInterface* controller)
     : _videoController(controller)
 {}
 
-void LCDControlRegister::Write(variant<uint8_t, uint16_t> value)
+void LCDControlRegister::WriteByte(uint8_t value)
 { 
     auto oldValue = _value;
     
-    _value = Extract8BitValue(value);
+    _value = value;
     ProcessValue(oldValue);
 }
 
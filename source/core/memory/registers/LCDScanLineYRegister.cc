@@ -10,7 +10,7 @@ LCDScanLineYRegister::LCDScanLineYRegister(VideoControllerInterface* controller)
     : _videoController(controller)
 {}
     
-void LCDScanLineYRegister::Write([[maybe_unused]] std::variant<uint8_t, uint16_t> value)
+void LCDScanLineYRegister::WriteByte([[maybe_unused]] uint8_t value)
 {}
 
 void LCDScanLineYRegister::UpdateScanLineValue(uint8_t scanLine)
@@ -10,10 +10,10 @@ LCDStatusRegister::LCDStatusRegister(VideoControllerInterface* controller)
     : _videoController(controller)
 {}
 
-void LCDStatusRegister::Write(std::variant<uint8_t, uint16_t> value)
+void LCDStatusRegister::WriteByte(uint8_t value)
 {
     auto originalValue = _value & 0x07; // save bits 0, 1, 2
-    auto valueToBeWritten = Extract8BitValue(value);;
+    auto valueToBeWritten = value;;
     DecodeRegisterValue(valueToBeWritten, originalValue);
 
     // Update Interrupt Modes
@@ -11,9 +11,9 @@ LCDWindowScrollXRegister::LCDWindowScrollXRegister(VideoControllerInterface* con
     : _videoController(controller)
 {}
      
-void LCDWindowScrollXRegister::Write(variant<uint8_t, uint16_t> value)
+void LCDWindowScrollXRegister::WriteByte(uint8_t value)
 {
-    _value = Extract8BitValue(value);
+    _value = value;
     _videoController->ScrollWindowX(_value);
 }
 
@@ -11,9 +11,9 @@ LCDWindowScrollYRegister::LCDWindowScrollYRegister(VideoControllerInterface* con
     : _videoController(controller)
 {}
      
-void LCDWindowScrollYRegister::Write(variant<uint8_t, uint16_t> value)
+void LCDWindowScrollYRegister::WriteByte(uint8_t value)
 {
-    _value = Extract8BitValue(value);
+    _value = value;
     _videoController->ScrollWindowY(_value);
 }
 
@@ -5,7 +5,7 @@ CC = clang++
 
 LDFLAGS = $(LDCOVERAGE_FLAGS)
 CPPFLAGS = $(CCCOVERAGE_FLAGS) $(GLOBAL_CPP_FLAGS)
-INCLUDE =  -I$(INCLUDE_CORE_TOP) -I$(INCLUDE_CORE_INSTRUCTIONS) -I$(INCLUDE_CORE_INTERFACES) -I$(INCLUDE_CORE_MEMORY) -I$(INCLUDE_CORE_MEMORY_REGISTERS)
+INCLUDE =  -I$(INCLUDE_CORE_TOP) -I$(INCLUDE_CORE_CONSTANTS) -I$(INCLUDE_CORE_INSTRUCTIONS) -I$(INCLUDE_CORE_INTERFACES) -I$(INCLUDE_CORE_MEMORY) -I$(INCLUDE_CORE_MEMORY_REGISTERS) -I$(INCLUDE_COMMONS_TOP)
 
 SRC_FILES = $(notdir $(wildcard ./*.cc)) $(notdir $(wildcard */*.cc))
 OBJ_FILES = $(patsubst %.cc,$(BUILD_TEMP)/%.o,$(SRC_FILES))
@@ -0,0 +1,50 @@
+#include "OAMDMARegister.h"
+
+using namespace gbxcore::constants;
+using namespace gbxcore::interfaces;
+using namespace std;
+
+namespace gbxcore::memory::registers
+{
+
+OAMDMARegister::OAMDMARegister(MemoryController* controller, CycleSource cycles)
+    : _memoryController(controller)
+    , _cycles(cycles)
+{}
+
+// The whole transfer is done up front as one bulk copy; what is left to model is the window in which the CPU can only
+// reach HRAM, which ends once the cycle counter reaches the end of the transfer. With a scheduler, the bus is handed
+// back at that cycle rather than on the next access to a locked page.
+void OAMDMARegister::WriteByte(uint8_t value)
+{
+    _value = value;
+    _memoryController->BusMasterCopyBlock(static_cast<size_t>(value) << 8, DMGBCOAMInitialAddress, DMGBCOAMDMATransferSize);
+    _transferEnd = _cycles() + DMGBCOAMDMATransferCycles;
+    _memoryController->LockBus(this, AddressRange(DMGBCHRAMInitialAddress, DMGBCHRAMFinalAddress, RangeType::BeginInclusive));
+
+    if (_scheduler != nullptr)
+    {
+        _scheduler->Schedule(_transferEnd, [this](uint64_t)
+        {
+            if (!HoldsBus())
+                _memoryController->ReleaseBus(this);
+        });
+    }
+}
+
+void OAMDMARegister::RegisterScheduler(EventScheduler* scheduler)
+{
+    _scheduler = scheduler;
+}
+
+bool OAMDMARegister::HoldsBus()
+{
+    return _cycles() < _transferEnd;
+}
+
+uint64_t OAMDMARegister::TransferEnd()
+{
+    return _transferEnd;
+}
+
+}
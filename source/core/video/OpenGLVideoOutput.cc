@@ -12,6 +12,7 @@ OpenGLVideoOutput::OpenGLVideoOutput(gbxcore::memory::RAM* vram)
   : _dmgbcVideoRAM(vram)
   , _viewPortScalingFactorX(DefaultViewPortScaleX)
   , _viewPortScalingFactorY(DefaultViewPortScaleY)
+  , _gbxFramePixels(gbxcore::memory::AllocateZeroPages<RGBColor>(GBXFramePixelCount))
 {}
 
 void OpenGLVideoOutput::Initialize()
@@ -145,7 +146,7 @@ void OpenGLVideoOutput::ConvertTileToPixel()
         {
             // tile
             // Adjust tile position based on the screen 'windowing'
-            auto tile = get<uint8_t>(_dmgbcVideoRAM->Read(_backgroundTileMapBase + (i + j*gbxcore::constants::DMGBCMaxBackgroundHorizontalTileCount), MemoryAccessType::Byte));
+            auto tile = _dmgbcVideoRAM->ReadByte(_backgroundTileMapBase + (i + j*gbxcore::constants::DMGBCMaxBackgroundHorizontalTileCount));
 
             // Convert the tile's pixels
             auto tilePixelsBasePosition = _backgroundAndWindowTileSetBase + 16*tile;
@@ -154,8 +155,8 @@ void OpenGLVideoOutput::ConvertTileToPixel()
 
             for (auto k = 0; k < 16; k += 2)
             {
-                auto msByte = get<uint8_t>(_dmgbcVideoRAM->Read(tilePixelsBasePosition + k, MemoryAccessType::Byte));
-                auto lsByte = get<uint8_t>(_dmgbcVideoRAM->Read(tilePixelsBasePosition + k + 1, MemoryAccessType::Byte));
+                auto msByte = _dmgbcVideoRAM->ReadByte(tilePixelsBasePosition + k);
+                auto lsByte = _dmgbcVideoRAM->ReadByte(tilePixelsBasePosition + k + 1);
 
                 for (auto l = 0; l < 8; ++l)
                 {
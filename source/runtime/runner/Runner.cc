@@ -1,5 +1,8 @@
 #include "Runner.h"
 
+#include <algorithm>
+
+#include "GBXEmulatorExceptions.h"
 
 using namespace gbxcore::interfaces;
 using namespace std;
@@ -35,14 +38,39 @@ void Runner::Run(CancellationToken& token)
 
 inline void Runner::RunHeadless(CancellationToken& token)
 {
+    auto isCancelled = [&token]() { return token.IsCancelled(); };
+
     while (!token.IsCancelled())
-        _runtime->Run();
+    {
+        auto reason = _runtime->RunFrame(isCancelled);
+
+        if (reason == StopReason::Error)
+            throw GBXEmulatorExceptions(_runtime->LastError());
+
+        if (reason == StopReason::Breakpoint)
+            break;
+    }
 }
 
 inline void Runner::RunHeadless(size_t numberOfCycles, CancellationToken& token)
 {
-    for (auto i = 0llu; i < numberOfCycles && !token.IsCancelled(); ++i)
-        _runtime->Run();
+    auto isCancelled = [&token]() { return token.IsCancelled(); };
+
+    for (auto remaining = numberOfCycles; remaining > 0 && !token.IsCancelled(); )
+    {
+        auto batch = min(remaining, HeadlessBatchSize);
+        auto executedInstructions = _runtime->Instructions();
+        auto reason = _runtime->RunInstructions(batch, isCancelled);
+
+        if (reason == StopReason::Error)
+            throw GBXEmulatorExceptions(_runtime->LastError());
+
+        if (reason == StopReason::Breakpoint)
+            break;
+
+        // Batches that halted or were cancelled stop short of their budget
+        remaining -= min(remaining, _runtime->Instructions() - executedInstructions);
+    }
 }
 
 inline void Runner::RunWithDebugger(CancellationToken& token)
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "TestUtils.h"
+
+#include "GBXCommonsExceptions.h"
+#include "MappedFile.h"
+
+using namespace std;
+using namespace gbxcommons;
+
+std::string SampleBinMappedFileName()
+{
+    return GBXTestEnvironment::TestDataPath + "sample.bin";
+}
+
+TEST(CommonsTests_MappedFile, MapFile)
+{
+    MappedFile file(SampleBinMappedFileName());
+    EXPECT_FALSE(file.IsMapped());
+
+    file.Map();
+    EXPECT_TRUE(file.IsMapped());
+    EXPECT_EQ(16llu, file.Size());
+
+    auto expectedContent = {0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99};
+    auto position = 0llu;
+
+    for (auto byte : expectedContent)
+        EXPECT_EQ(static_cast<uint8_t>(byte), file.Data()[position++]);
+}
+
+TEST(CommonsTests_MappedFile, MovedFileKeepsMapping)
+{
+    MappedFile file(SampleBinMappedFileName());
+    file.Map();
+    auto data = file.Data();
+
+    MappedFile moved(std::move(file));
+    EXPECT_FALSE(file.IsMapped());
+    EXPECT_EQ(data, moved.Data());
+    EXPECT_EQ(0xAA, moved.Data()[0]);
+}
+
+TEST(CommonsTests_MappedFile, MapInvalidFile)
+{
+    MappedFile file(GBXTestEnvironment::TestDataPath + "nofile.bin");
+
+    ASSERT_EXCEPTION( { file.Map(); }, 
+                      MappedFileException, 
+                      "Unable to map file './build/test/test_data/nofile.bin'");
+    ASSERT_EXCEPTION( { static_cast<void>(file.Data()); }, 
+                      MappedFileException, 
+                      "File has not yet been mapped");
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GBXCommonsExceptions.h"
+#include "SaveFile.h"
+
+using namespace std;
+using namespace gbxcommons;
+
+vector<uint8_t> ReadSaveFileContent(const string& fileName)
+{
+    ifstream file(fileName, ios::binary);
+    return vector<uint8_t>(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+}
+
+TEST(CommonsTests_SaveFile, CreateSaveFile)
+{
+    const string fileName = "CommonsTests_SaveFile.create.sav";
+    remove(fileName.c_str());
+
+    {
+        SaveFile save(fileName, 0x2000);
+        EXPECT_EQ(0x2000llu, save.Size());
+        EXPECT_EQ(0x00, save.Data()[0x1FFF]);
+    }
+
+    EXPECT_EQ(0x2000llu, filesystem::file_size(fileName));
+    remove(fileName.c_str());
+}
+
+TEST(CommonsTests_SaveFile, WritesPersistAndTrailingDataIsKept)
+{
+    const string fileName = "CommonsTests_SaveFile.persist.sav";
+    ofstream(fileName, ios::binary) << string(0x130, '\xAB');
+
+    {
+        SaveFile save(fileName, 0x100);
+        EXPECT_EQ(0xAB, save.Data()[0x00]);
+
+        save.Data()[0x10] = 0x42;
+        save.MarkDirty(0x10);
+    }
+
+    auto content = ReadSaveFileContent(fileName);
+    remove(fileName.c_str());
+
+    ASSERT_EQ(0x130llu, content.size());
+    EXPECT_EQ(0x42, content[0x10]);
+    EXPECT_EQ(0xAB, content[0x12F]);
+}
+
+TEST(CommonsTests_SaveFile, DirtyBlocksTrackedPerBlock)
+{
+    const string fileName = "CommonsTests_SaveFile.dirty.sav";
+    SaveFile save(fileName, 0x8000);
+
+    save.MarkDirty(0x0000);
+    save.MarkDirty(0x00FF);
+    save.MarkDirty(0x0100);
+    save.MarkDirty(0x7FFF);
+    EXPECT_EQ(3llu, save.DirtyBlockCount());
+
+    save.Flush();
+    EXPECT_EQ(0llu, save.DirtyBlockCount());
+    remove(fileName.c_str());
+}
+
+TEST(CommonsTests_SaveFile, BackgroundFlusherSyncsDirtyBlocks)
+{
+    const string fileName = "CommonsTests_SaveFile.flusher.sav";
+    SaveFile save(fileName, 0x2000);
+
+    save.StartFlushing(chrono::milliseconds(1));
+    EXPECT_TRUE(save.IsFlushing());
+
+    save.Data()[0x1234] = 0x99;
+    save.MarkDirty(0x1234);
+
+    for (auto attempt = 0; attempt < 1000 && save.DirtyBlockCount() != 0; ++attempt)
+        this_thread::sleep_for(chrono::milliseconds(1));
+
+    EXPECT_EQ(0llu, save.DirtyBlockCount());
+    EXPECT_EQ(0x99, ReadSaveFileContent(fileName)[0x1234]);
+
+    save.StopFlushing();
+    EXPECT_FALSE(save.IsFlushing());
+    remove(fileName.c_str());
+}
+
+TEST(CommonsTests_SaveFile, UnmappableSaveFile)
+{
+    ASSERT_THROW(SaveFile save("non_existent_directory/CommonsTests_SaveFile.sav", 0x2000), SaveFileException);
+}
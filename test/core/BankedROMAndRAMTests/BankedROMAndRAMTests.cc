@@ -4,12 +4,16 @@
 #include "TestUtils.h"
 
 #include <chrono>
+#include <cstdio>
 #include <memory>
 #include <thread>
 #include <variant>
 
 #include "BankedROM.h"
+#include "BatteryBackedRAM.h"
 #include "FileLoader.h"
+#include "MappedFile.h"
+#include "SaveFile.h"
 #include "GBXCoreExceptions.h"
 
 using namespace std;
@@ -172,3 +176,78 @@ TEST(CoreTests_BankedROMAndROM, WriteToROM2)
                       BankedMemoryException, 
                       "Address '255' is out of bank '2' bounds (bank size = 128)");
 }
+
+TEST(CoreTests_BankedROMAndROM, MapFileIntoBankedROM) 
+{
+    auto file = make_shared<MappedFile>(GBXTestEnvironment::TestDataPath + "banked_memory_resource.bin");
+    file->Map();
+
+    // Mapped content made of whole banks is used in place and sets the number of banks
+    BankedROM bankedROM(4096, 128llu);
+    bankedROM.Map(shared_ptr<const uint8_t>(file, file->Data()), file->Size());
+
+    EXPECT_EQ(2048llu, bankedROM.PhysicalResourceSize());
+    EXPECT_EQ(16llu, bankedROM.BankCount());
+    EXPECT_EQ(file->Data(), bankedROM.Data());
+
+    auto expectedBytes = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0xEE};
+    for (auto bank = 0llu; bank < 16llu; ++bank)
+    {
+        bankedROM.SelectBank(bank);
+        EXPECT_EQ(*(expectedBytes.begin() + bank), bankedROM.ReadByte(0));
+        EXPECT_EQ(*(expectedBytes.begin() + bank), bankedROM.ReadByte(127));
+    }
+
+    ASSERT_EXCEPTION( { bankedROM.SelectBank(16); }, 
+                      BankedMemoryException, 
+                      "Invalid memory bank '16' selected");
+}
+
+TEST(CoreTests_BankedROMAndROM, LoadIntoMappedBankedROMCopiesContent) 
+{
+    auto file = make_shared<MappedFile>(GBXTestEnvironment::TestDataPath + "banked_memory_resource.bin");
+    file->Map();
+
+    BankedROM bankedROM(2048, 128llu);
+    bankedROM.Map(shared_ptr<const uint8_t>(file, file->Data()), file->Size());
+    bankedROM.SelectBank(1);
+
+    uint8_t content[] = {0x42, 0x43};
+    bankedROM.Load(make_shared<uint8_t*>(content), 2, nullopt);
+
+    EXPECT_NE(file->Data(), bankedROM.Data());
+    EXPECT_EQ(0x4342, bankedROM.ReadWord(0));
+    EXPECT_EQ(0x22, bankedROM.ReadByte(2));
+    EXPECT_EQ(0x22, file->Data()[128]);
+}
+
+TEST(CoreTests_BankedROMAndROM, BatteryBackedRAMWritesThroughToSaveFile)
+{
+    const string saveName = "CoreTests_BankedROMAndROM.sav";
+    BatteryBackedRAM ram(0x20000, 0x2000);
+
+    ram.Attach(make_unique<SaveFile>(saveName, 0x8000));
+    EXPECT_EQ(4llu, ram.BankCount());
+    EXPECT_EQ(nullptr, ram.Data());
+
+    ram.SelectBank(3);
+    ram.WriteByte(0x42, 0x0010);
+    ram.WriteWord(0xBEEF, 0x01FF);
+
+    EXPECT_EQ(0x42, ram.Save()->Data()[3 * 0x2000 + 0x0010]);
+    EXPECT_EQ(0xBE, ram.Save()->Data()[3 * 0x2000 + 0x0200]);
+    EXPECT_EQ(3llu, ram.Save()->DirtyBlockCount());
+
+    // Writes ignored by disabled RAM do not dirty the save
+    ram.Save()->Flush();
+    ram.Enable(false);
+    ram.WriteByte(0x11, 0x0010);
+    EXPECT_EQ(0llu, ram.Save()->DirtyBlockCount());
+
+    ram.Detach();
+    EXPECT_EQ(16llu, ram.BankCount());
+    remove(saveName.c_str());
+
+    ASSERT_THROW(ram.Attach(make_unique<SaveFile>(saveName, 0x1000)), MemoryAccessException);
+    remove(saveName.c_str());
+}
@@ -13,7 +13,7 @@ OBJ_FILES = $(patsubst %.cc,$(BUILD_TEMP)/%.o,$(SRC_FILES))
 DEP_FILES = $(patsubst %.o,%.d,$(OBJ_FILES))
 
 # Add test dependencies here (.cc files only)
-MODULES = GBXCoreExceptions BankedROM FileLoader
+MODULES = GBXCoreExceptions BankedROM BankedRAM BatteryBackedRAM FileLoader MappedFile SaveFile
 MODULES_DEPS = $(addsuffix .o, $(addprefix $(BUILD_TEMP)/,$(MODULES)))
 
 .PHONY: all
@@ -65,4 +65,14 @@ TEST(CoreTests_Clock, MultipkleTickWithDelay)
     EXPECT_EQ(static_cast<uint64_t>(4), clock.Ticks());
     EXPECT_TRUE(duration >= chrono::nanoseconds(static_cast<uint64_t>(GBCPeriodInNanoSeconds)));
     EXPECT_TRUE(duration <= chrono::nanoseconds(static_cast<uint64_t>(GBCPeriodInNanoSeconds * 4)));
-}
\ No newline at end of file
+}
+
+TEST(CoreTests_Clock, AdvanceWithoutDelay)
+{
+    Clock clock(GBCClockPeriod);
+
+    clock.Advance(DMGBCMachineCyclesPerFrame);
+    clock.Advance(4);
+
+    EXPECT_EQ(DMGBCMachineCyclesPerFrame + 4, clock.Ticks());
+}
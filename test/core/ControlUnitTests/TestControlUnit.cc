@@ -3446,4 +3446,37 @@ TEST(CoreTests_ControlUnit, TestLDUWithRegisterIndirectSourceIncrement)
 
     EXPECT_EQ(0xCC, registerBank.Read(Register::A));
     EXPECT_EQ(0x0104, registerBank.ReadPair(Register::DE));
-}
\ No newline at end of file
+}
+
+TEST(CoreTests_ControlUnit, TestLDUAfterBranchNotTaken)
+{
+    MemoryControllerMock memoryController;
+    ArithmeticLogicDecorator arithmeticLogicUnit;
+    RegisterBank registerBank;
+    arithmeticLogicUnit.Initialize(&registerBank);
+    arithmeticLogicUnit.InitializeRegisters();
+    auto controlUnit = make_shared<ControlUnit>();
+         controlUnit->Initialize(&memoryController, &arithmeticLogicUnit);
+
+    registerBank.WritePair(Register::DE, 0x0104);
+
+    // XOR A; JR NZ, 0x02 (not taken); LDU A, [DE]
+    EXPECT_CALL(memoryController, Read(0x0000, MemoryAccessType::Byte)).WillOnce(Return(static_cast<uint8_t>(0xAF)));
+    EXPECT_CALL(memoryController, Read(0x0001, MemoryAccessType::Byte)).WillOnce(Return(static_cast<uint8_t>(0x20)));
+    EXPECT_CALL(memoryController, Read(0x0002, MemoryAccessType::Byte)).WillOnce(Return(static_cast<uint8_t>(0x02)));
+    EXPECT_CALL(memoryController, Read(0x0003, MemoryAccessType::Byte)).WillOnce(Return(static_cast<uint8_t>(0xFC)));
+    EXPECT_CALL(memoryController, Read(0x0004, MemoryAccessType::Byte)).WillOnce(Return(static_cast<uint8_t>(0x1A)));
+    EXPECT_CALL(memoryController, Read(0x0104, MemoryAccessType::Byte)).WillOnce(Return(static_cast<uint8_t>(0xCC)));
+
+    EXPECT_CALL(memoryController, SecurityLevel()).WillRepeatedly(Return(PrivilegeMode::System));
+    EXPECT_CALL(memoryController, SetSecurityLevel(PrivilegeMode::User)).Times(1);
+    EXPECT_CALL(memoryController, SetSecurityLevel(PrivilegeMode::System)).Times(1);
+
+    controlUnit->RunCycle();
+    controlUnit->RunCycle();
+    EXPECT_TRUE(arithmeticLogicUnit.IsExecutionAborted());
+    EXPECT_EQ(0x0003, registerBank.ReadPair(Register::PC));
+
+    controlUnit->RunCycle();
+    EXPECT_EQ(0xCC, registerBank.Read(Register::A));
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "AddressRange.h"
+#include "CGBHDMAAddressRegister.h"
+#include "CGBHDMAControlRegister.h"
+#include "DMGAndGBCRegisterAddresses.h"
+#include "MemoryController.h"
+#include "RAM.h"
+#include "SystemConstants.h"
+#include "SystemMode.h"
+
+using namespace std;
+using namespace gbxcore;
+using namespace gbxcore::constants;
+using namespace gbxcore::interfaces;
+using namespace gbxcore::memory;
+using namespace gbxcore::memory::registers;
+
+// VRAM and work RAM (filled with a pattern), with the HDMA registers stalling a cycle counter owned by the test
+CGBHDMAControlRegister* RegisterHDMATestMap(MemoryController& memory, uint64_t& stalled)
+{
+    auto sourceHigh = make_unique<CGBHDMAAddressRegister>();
+    auto sourceLow = make_unique<CGBHDMAAddressRegister>();
+    auto destinationHigh = make_unique<CGBHDMAAddressRegister>();
+    auto destinationLow = make_unique<CGBHDMAAddressRegister>();
+    auto control = make_unique<CGBHDMAControlRegister>(&memory, [&stalled](uint64_t cycles) { stalled += cycles; });
+    auto controlPointer = control.get();
+
+    control->RegisterAddressRegisters(sourceHigh.get(), sourceLow.get(), destinationHigh.get(), destinationLow.get());
+
+    memory.RegisterMemoryResource(make_unique<RAM>(DMGBCVideoRAMPhysicalSize), AddressRange(DMGBCVideoRAMInitialAddress, DMGBCVideoRAMFinalAddress, RangeType::BeginInclusive), PrivilegeMode::User);
+    memory.RegisterMemoryResource(make_unique<RAM>(0x2000), AddressRange(0xC000, 0xE000, RangeType::BeginInclusive), PrivilegeMode::User);
+    memory.RegisterMemoryMappedRegister(std::move(sourceHigh), CGBHDMASourceHighAddress, PrivilegeMode::Both);
+    memory.RegisterMemoryMappedRegister(std::move(sourceLow), CGBHDMASourceLowAddress, PrivilegeMode::Both);
+    memory.RegisterMemoryMappedRegister(std::move(destinationHigh), CGBHDMADestinationHighAddress, PrivilegeMode::Both);
+    memory.RegisterMemoryMappedRegister(std::move(destinationLow), CGBHDMADestinationLowAddress, PrivilegeMode::Both);
+    memory.RegisterMemoryMappedRegister(std::move(control), CGBHDMAControlAddress, PrivilegeMode::Both);
+    memory.SetSecurityLevel(PrivilegeMode::User);
+
+    for (auto offset = 0llu; offset < 0x2000; ++offset)
+        memory.Write(static_cast<uint8_t>(offset * 3 + 1), 0xC000 + offset);
+
+    return controlPointer;
+}
+
+void SetHDMAAddresses(MemoryController& memory, uint16_t source, uint16_t destination)
+{
+    memory.Write(static_cast<uint8_t>(source >> 8), CGBHDMASourceHighAddress);
+    memory.Write(static_cast<uint8_t>(source & 0xFF), CGBHDMASourceLowAddress);
+    memory.Write(static_cast<uint8_t>(destination >> 8), CGBHDMADestinationHighAddress);
+    memory.Write(static_cast<uint8_t>(destination & 0xFF), CGBHDMADestinationLowAddress);
+}
+
+uint8_t ReadHDMATestByte(MemoryController& memory, size_t address)
+{
+    return get<uint8_t>(memory.Read(address, MemoryAccessType::Byte));
+}
+
+TEST(CoreTests_HDMA, GeneralPurposeTransferRunsAtOnce)
+{
+    MemoryController memory;
+    uint64_t stalled = 0;
+    RegisterHDMATestMap(memory, stalled);
+
+    // Lower four bits of both addresses are ignored, and the destination is always in VRAM
+    SetHDMAAddresses(memory, 0xC12F, 0x8825);
+    memory.Write(static_cast<uint8_t>(0x03), CGBHDMAControlAddress);
+
+    for (auto offset = 0llu; offset < 0x40; ++offset)
+        EXPECT_EQ(ReadHDMATestByte(memory, 0xC120 + offset), ReadHDMATestByte(memory, 0x8820 + offset));
+
+    EXPECT_EQ(0x00, ReadHDMATestByte(memory, 0x8860));
+    EXPECT_EQ(4 * CGBVideoRAMDMABlockCycles, stalled);
+    EXPECT_EQ(0xFF, ReadHDMATestByte(memory, CGBHDMAControlAddress));
+    EXPECT_EQ(0xFF, ReadHDMATestByte(memory, CGBHDMASourceHighAddress));
+}
+
+TEST(CoreTests_HDMA, HBlankTransferCopiesOneBlockPerHBlank)
+{
+    MemoryController memory;
+    uint64_t stalled = 0;
+    auto control = RegisterHDMATestMap(memory, stalled);
+
+    SetHDMAAddresses(memory, 0xD000, 0x0000);
+    memory.Write(static_cast<uint8_t>(0x82), CGBHDMAControlAddress);
+
+    EXPECT_TRUE(control->IsHBlankTransferActive());
+    EXPECT_EQ(0x02, ReadHDMATestByte(memory, CGBHDMAControlAddress));
+    EXPECT_EQ(0x00, ReadHDMATestByte(memory, 0x8000));
+    EXPECT_EQ(0llu, stalled);
+
+    control->OnHBlank();
+    EXPECT_EQ(ReadHDMATestByte(memory, 0xD00F), ReadHDMATestByte(memory, 0x800F));
+    EXPECT_EQ(0x00, ReadHDMATestByte(memory, 0x8010));
+    EXPECT_EQ(0x01, ReadHDMATestByte(memory, CGBHDMAControlAddress));
+    EXPECT_EQ(CGBVideoRAMDMABlockCycles, stalled);
+
+    control->OnHBlank();
+    control->OnHBlank();
+    EXPECT_EQ(ReadHDMATestByte(memory, 0xD02F), ReadHDMATestByte(memory, 0x802F));
+    EXPECT_EQ(0x00, ReadHDMATestByte(memory, 0x8030));
+    EXPECT_FALSE(control->IsHBlankTransferActive());
+    EXPECT_EQ(0xFF, ReadHDMATestByte(memory, CGBHDMAControlAddress));
+
+    control->OnHBlank();
+    EXPECT_EQ(0x00, ReadHDMATestByte(memory, 0x8030));
+    EXPECT_EQ(3 * CGBVideoRAMDMABlockCycles, stalled);
+}
+
+TEST(CoreTests_HDMA, HBlankTransferCanBeStopped)
+{
+    MemoryController memory;
+    uint64_t stalled = 0;
+    auto control = RegisterHDMATestMap(memory, stalled);
+
+    SetHDMAAddresses(memory, 0xC000, 0x1000);
+    memory.Write(static_cast<uint8_t>(0x84), CGBHDMAControlAddress);
+    control->OnHBlank();
+    memory.Write(static_cast<uint8_t>(0x00), CGBHDMAControlAddress);
+
+    EXPECT_FALSE(control->IsHBlankTransferActive());
+    EXPECT_EQ(0x83, ReadHDMATestByte(memory, CGBHDMAControlAddress));
+
+    control->OnHBlank();
+    EXPECT_EQ(0x00, ReadHDMATestByte(memory, 0x9010));
+    EXPECT_EQ(CGBVideoRAMDMABlockCycles, stalled);
+}
+
+TEST(CoreTests_HDMA, TransferStopsAtTheEndOfVideoRAM)
+{
+    MemoryController memory;
+    uint64_t stalled = 0;
+    RegisterHDMATestMap(memory, stalled);
+
+    SetHDMAAddresses(memory, 0xC000, 0x1FE0);
+    memory.Write(static_cast<uint8_t>(0x03), CGBHDMAControlAddress);
+
+    EXPECT_EQ(ReadHDMATestByte(memory, 0xC01F), ReadHDMATestByte(memory, 0x9FFF));
+    EXPECT_EQ(0xFF, ReadHDMATestByte(memory, CGBHDMAControlAddress));
+}
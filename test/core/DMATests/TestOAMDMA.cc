@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "AddressRange.h"
+#include "DMGAndGBCRegisterAddresses.h"
+#include "EventScheduler.h"
+#include "MemoryController.h"
+#include "OAMDMARegister.h"
+#include "RAM.h"
+#include "SystemConstants.h"
+#include "SystemMode.h"
+
+using namespace std;
+using namespace gbxcore;
+using namespace gbxcore::constants;
+using namespace gbxcore::interfaces;
+using namespace gbxcore::memory;
+using namespace gbxcore::memory::registers;
+
+// Work RAM, OAM and HRAM, with the DMA register driven by a cycle counter owned by the test
+OAMDMARegister* RegisterOAMDMATestMap(MemoryController& memory, uint64_t& cycles)
+{
+    auto dma = make_unique<OAMDMARegister>(&memory, [&cycles]() { return cycles; });
+    auto dmaPointer = dma.get();
+
+    memory.RegisterMemoryResource(make_unique<RAM>(0x2000), AddressRange(0xC000, 0xE000, RangeType::BeginInclusive), PrivilegeMode::User);
+    memory.RegisterMemoryResource(make_unique<RAM>(DMGBCOAMPhysicalSize), AddressRange(DMGBCOAMInitialAddress, DMGBCOAMFinalAddress, RangeType::BeginInclusive), PrivilegeMode::User);
+    memory.RegisterMemoryResource(make_unique<RAM>(DMGBCHRAMPhysicalSize), AddressRange(DMGBCHRAMInitialAddress, DMGBCHRAMFinalAddress, RangeType::BeginInclusive), PrivilegeMode::User);
+    memory.RegisterMemoryMappedRegister(std::move(dma), OAMDMARegisterAddress, PrivilegeMode::Both);
+    memory.SetSecurityLevel(PrivilegeMode::User);
+
+    return dmaPointer;
+}
+
+TEST(CoreTests_OAMDMA, TransferCopiesSourcePageIntoOAM)
+{
+    MemoryController memory;
+    uint64_t cycles = 0;
+    RegisterOAMDMATestMap(memory, cycles);
+
+    for (auto offset = 0llu; offset < 0x100; ++offset)
+        memory.Write(static_cast<uint8_t>(offset ^ 0x5A), 0xC100 + offset);
+
+    cycles = 1000;
+    memory.Write(static_cast<uint8_t>(0xC1), OAMDMARegisterAddress);
+    cycles += DMGBCOAMDMATransferCycles;
+
+    for (auto offset = 0llu; offset < DMGBCOAMDMATransferSize; ++offset)
+        EXPECT_EQ(static_cast<uint8_t>(offset ^ 0x5A), get<uint8_t>(memory.Read(DMGBCOAMInitialAddress + offset, MemoryAccessType::Byte)));
+
+    EXPECT_EQ(0x00, get<uint8_t>(memory.Read(DMGBCOAMInitialAddress + DMGBCOAMDMATransferSize, MemoryAccessType::Byte)));
+    EXPECT_EQ(0xC1, get<uint8_t>(memory.Read(OAMDMARegisterAddress, MemoryAccessType::Byte)));
+}
+
+TEST(CoreTests_OAMDMA, OnlyHRAMIsAccessibleDuringTransfer)
+{
+    MemoryController memory;
+    uint64_t cycles = 500;
+    auto dma = RegisterOAMDMATestMap(memory, cycles);
+
+    memory.Write(static_cast<uint8_t>(0x12), 0xC000);
+    memory.Write(static_cast<uint8_t>(0xC0), OAMDMARegisterAddress);
+
+    EXPECT_EQ(500 + DMGBCOAMDMATransferCycles, dma->TransferEnd());
+    EXPECT_TRUE(memory.IsBusLocked());
+    EXPECT_EQ(0xFF, get<uint8_t>(memory.Read(0xC000, MemoryAccessType::Byte)));
+    EXPECT_EQ(0xFFFF, get<uint16_t>(memory.Read(DMGBCOAMInitialAddress, MemoryAccessType::Word)));
+
+    memory.Write(static_cast<uint8_t>(0x34), 0xC000);
+    memory.Write(static_cast<uint8_t>(0x56), 0xFF80);
+    EXPECT_EQ(0x56, get<uint8_t>(memory.Read(0xFF80, MemoryAccessType::Byte)));
+
+    cycles += DMGBCOAMDMATransferCycles - 1;
+    EXPECT_EQ(0xFF, get<uint8_t>(memory.Read(0xC000, MemoryAccessType::Byte)));
+
+    cycles += 1;
+    EXPECT_EQ(0x12, get<uint8_t>(memory.Read(0xC000, MemoryAccessType::Byte)));
+    EXPECT_FALSE(memory.IsBusLocked());
+
+    memory.Write(static_cast<uint8_t>(0x34), 0xC000);
+    EXPECT_EQ(0x34, get<uint8_t>(memory.Read(0xC000, MemoryAccessType::Byte)));
+}
+
+TEST(CoreTests_OAMDMA, LockSurvivesSecurityLevelChanges)
+{
+    MemoryController memory;
+    uint64_t cycles = 0;
+    RegisterOAMDMATestMap(memory, cycles);
+
+    memory.Write(static_cast<uint8_t>(0xC0), OAMDMARegisterAddress);
+    memory.SetSecurityLevel(PrivilegeMode::User);
+    EXPECT_EQ(0xFF, get<uint8_t>(memory.Read(0xC000, MemoryAccessType::Byte)));
+
+    cycles = DMGBCOAMDMATransferCycles;
+    EXPECT_EQ(0x00, get<uint8_t>(memory.Read(0xC000, MemoryAccessType::Byte)));
+}
+
+TEST(CoreTests_OAMDMA, SchedulerReleasesTheBusAtTheEndOfTheTransfer)
+{
+    MemoryController memory;
+    EventScheduler scheduler;
+    uint64_t cycles = 0;
+    auto dma = RegisterOAMDMATestMap(memory, cycles);
+    dma->RegisterScheduler(&scheduler);
+
+    memory.Write(static_cast<uint8_t>(0xC0), OAMDMARegisterAddress);
+    EXPECT_EQ(DMGBCOAMDMATransferCycles, scheduler.NextEventCycle());
+
+    // A transfer restarted before the first one ends keeps the bus until its own end
+    cycles = 100;
+    memory.Write(static_cast<uint8_t>(0xC0), OAMDMARegisterAddress);
+    cycles = DMGBCOAMDMATransferCycles;
+    scheduler.RunDue(cycles);
+    EXPECT_TRUE(memory.IsBusLocked());
+
+    cycles = 100 + DMGBCOAMDMATransferCycles;
+    scheduler.RunDue(cycles);
+    EXPECT_FALSE(memory.IsBusLocked());
+    EXPECT_EQ(EventScheduler::NoPendingEvent, scheduler.NextEventCycle());
+}
+
+TEST(CoreTests_OAMDMA, RestartedTransferReadsTheSourceThroughTheUnlockedBus)
+{
+    MemoryController memory;
+    uint64_t cycles = 0;
+    RegisterOAMDMATestMap(memory, cycles);
+
+    for (auto offset = 0llu; offset < DMGBCOAMDMATransferSize; ++offset)
+        memory.Write(static_cast<uint8_t>(offset + 1), 0xC200 + offset);
+
+    memory.Write(static_cast<uint8_t>(0xC1), OAMDMARegisterAddress);
+    cycles = 10;
+    memory.Write(static_cast<uint8_t>(0xC2), OAMDMARegisterAddress);
+    cycles += DMGBCOAMDMATransferCycles;
+
+    for (auto offset = 0llu; offset < DMGBCOAMDMATransferSize; ++offset)
+        EXPECT_EQ(static_cast<uint8_t>(offset + 1), get<uint8_t>(memory.Read(DMGBCOAMInitialAddress + offset, MemoryAccessType::Byte)));
+}
+
+TEST(CoreTests_OAMDMA, BlockTransfersOverAnExpiredLock)
+{
+    MemoryController memory;
+    uint64_t cycles = 0;
+    RegisterOAMDMATestMap(memory, cycles);
+
+    for (auto offset = 0llu; offset < 0x300; ++offset)
+        memory.Write(static_cast<uint8_t>(offset * 7), 0xC000 + offset);
+
+    memory.Write(static_cast<uint8_t>(0xC0), OAMDMARegisterAddress);
+    cycles = DMGBCOAMDMATransferCycles;
+
+    // No release has run yet, so the transfers start on the locked view and must pick up the unlocked one
+    memory.CopyBlock(0xC000, 0xD000, 0x300);
+
+    for (auto offset = 0llu; offset < 0x300; ++offset)
+        EXPECT_EQ(static_cast<uint8_t>(offset * 7), get<uint8_t>(memory.Read(0xD000 + offset, MemoryAccessType::Byte)));
+
+    memory.Write(static_cast<uint8_t>(0xC0), OAMDMARegisterAddress);
+    cycles += DMGBCOAMDMATransferCycles;
+
+    vector<uint8_t> buffer(0x300);
+    memory.ReadBlock(0xD000, buffer);
+
+    for (auto offset = 0llu; offset < 0x300; ++offset)
+        EXPECT_EQ(static_cast<uint8_t>(offset * 7), buffer[offset]);
+}
+
+TEST(CoreTests_OAMDMA, CrossDomainReadsRespectTheLock)
+{
+    MemoryController memory;
+    uint64_t cycles = 0;
+    RegisterOAMDMATestMap(memory, cycles);
+
+    memory.Write(static_cast<uint8_t>(0x12), 0xC000);
+    memory.Write(static_cast<uint8_t>(0x34), 0xFF80);
+    memory.Write(static_cast<uint8_t>(0xC0), OAMDMARegisterAddress);
+
+    EXPECT_EQ(0xFF, memory.ReadByteAs(PrivilegeMode::User, 0xC000));
+    EXPECT_EQ(0x34, memory.ReadByteAs(PrivilegeMode::User, 0xFF80));
+
+    cycles = DMGBCOAMDMATransferCycles;
+    EXPECT_EQ(0x12, memory.ReadByteAs(PrivilegeMode::User, 0xC000));
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include "CoreTestMocksAndWrappers.h"
+
+#include <memory>
+#include <optional>
+
+#include "AddressRange.h"
+#include "ArithmeticLogicUnit.h"
+#include "BankedROM.h"
+#include "DecodedInstructionCache.h"
+#include "MemoryController.h"
+#include "Opcodes.h"
+#include "RAM.h"
+#include "RegisterBank.h"
+#include "SystemMode.h"
+
+using namespace std;
+using namespace gbxcore;
+using namespace gbxcore::memory;
+using namespace gbxcore::interfaces;
+using namespace gbxcore::instructions;
+
+TEST(CoreTests_DecodedInstructionCache, AllocateAndLookup)
+{
+    DecodedInstructionCache cache;
+
+    EXPECT_EQ(nullptr, cache.Lookup(PrivilegeMode::System, 0x0150));
+
+    auto& entry = cache.Allocate(PrivilegeMode::System, 0x0150);
+    entry.Predecoded.Length = 1;
+
+    EXPECT_EQ(&entry, cache.Lookup(PrivilegeMode::System, 0x0150));
+    EXPECT_EQ(nullptr, cache.Lookup(PrivilegeMode::User, 0x0150));
+    EXPECT_EQ(nullptr, cache.Lookup(PrivilegeMode::System, 0x0150 + DecodedInstructionCache::CacheSize));
+
+    cache.Flush();
+    EXPECT_EQ(nullptr, cache.Lookup(PrivilegeMode::System, 0x0150));
+}
+
+TEST(CoreTests_DecodedInstructionCache, InvalidateOnWrite)
+{
+    DecodedInstructionCache cache;
+
+    cache.Allocate(PrivilegeMode::User, 0x0200).Predecoded.Length = 1;
+    cache.Allocate(PrivilegeMode::User, 0x0300).Predecoded.Length = 2;
+
+    cache.OnWrite(0x0201);
+    EXPECT_NE(nullptr, cache.Lookup(PrivilegeMode::User, 0x0200));
+    cache.OnWrite(0x0200);
+    EXPECT_EQ(nullptr, cache.Lookup(PrivilegeMode::User, 0x0200));
+
+    cache.OnWrite(0x0301);
+    EXPECT_EQ(nullptr, cache.Lookup(PrivilegeMode::User, 0x0300));
+}
+
+TEST(CoreTests_DecodedInstructionCache, EntriesAreTaggedWithBank)
+{
+    DecodedInstructionCache cache;
+    AddressRange bankedRange(0x4000, 0x8000, RangeType::BeginInclusive);
+
+    cache.Allocate(PrivilegeMode::User, 0x4100).Predecoded.Length = 1;
+    EXPECT_NE(nullptr, cache.Lookup(PrivilegeMode::User, 0x4100));
+
+    cache.OnBankSwitch(PrivilegeMode::User, bankedRange, 0x02);
+    EXPECT_EQ(nullptr, cache.Lookup(PrivilegeMode::User, 0x4100));
+
+    cache.OnBankSwitch(PrivilegeMode::User, bankedRange, 0x00);
+    EXPECT_NE(nullptr, cache.Lookup(PrivilegeMode::User, 0x4100));
+}
+
+TEST(CoreTests_DecodedInstructionCache, FetchedInstructionsAreCachedAndInvalidated)
+{
+    RegisterBank registerBank;
+    MemoryController memoryController;
+    ArithmeticLogicUnit alu;
+
+    alu.Initialize(&registerBank);
+    alu.InitializeRegisters();
+
+    memoryController.RegisterMemoryResource(make_unique<RAM>(0x100), AddressRange(0x0000, 0x0100, RangeType::BeginInclusive), PrivilegeMode::System);
+    memoryController.SetSecurityLevel(PrivilegeMode::System);
+    memoryController.Write(static_cast<uint8_t>(0x00), 0x0000); // NOP
+
+    alu.AcquireInstruction(&memoryController);
+    alu.Decode();
+    EXPECT_EQ(0x0001, registerBank.ReadPair(Register::PC));
+
+    registerBank.WritePair(Register::PC, 0x0000);
+    alu.AcquireInstruction(&memoryController);
+    alu.Decode();
+    alu.Execute();
+    EXPECT_EQ(0x0001, registerBank.ReadPair(Register::PC));
+    EXPECT_FALSE(alu.IllegalInstructionSignal());
+
+    // Overwrite the cached opcode with an illegal one
+    memoryController.Write(static_cast<uint8_t>(0xE3), 0x0000);
+
+    registerBank.WritePair(Register::PC, 0x0000);
+    alu.AcquireInstruction(&memoryController);
+    alu.Decode();
+    alu.Execute();
+    EXPECT_EQ(0xE3, registerBank.Read(Register::IR));
+    EXPECT_TRUE(alu.IllegalInstructionSignal());
+}
+
+TEST(CoreTests_DecodedInstructionCache, PrefixedInstructionsAreCached)
+{
+    RegisterBank registerBank;
+    MemoryController memoryController;
+    ArithmeticLogicUnit alu;
+
+    alu.Initialize(&registerBank);
+    alu.InitializeRegisters();
+
+    memoryController.RegisterMemoryResource(make_unique<RAM>(0x100), AddressRange(0x0000, 0x0100, RangeType::BeginInclusive), PrivilegeMode::System);
+    memoryController.SetSecurityLevel(PrivilegeMode::System);
+    memoryController.Write(static_cast<uint8_t>(0xCB), 0x0010);
+    memoryController.Write(static_cast<uint8_t>(0x37), 0x0011); // SWAP A
+
+    for (auto i = 0; i < 2; ++i)
+    {
+        registerBank.WritePair(Register::PC, 0x0010);
+        registerBank.Write(Register::A, 0x12);
+        alu.AcquireInstruction(&memoryController);
+        alu.Decode();
+        alu.Execute();
+
+        EXPECT_EQ(0x0012, registerBank.ReadPair(Register::PC));
+        EXPECT_EQ(0xCB, registerBank.Read(Register::PIR));
+        EXPECT_EQ(0x21, registerBank.Read(Register::A));
+    }
+
+    // Replacing the second byte (opcode) must invalidate the entry
+    memoryController.Write(static_cast<uint8_t>(0x07), 0x0011); // RLC A
+
+    registerBank.WritePair(Register::PC, 0x0010);
+    registerBank.Write(Register::A, 0x01);
+    alu.AcquireInstruction(&memoryController);
+    alu.Decode();
+    alu.Execute();
+
+    EXPECT_EQ(0x02, registerBank.Read(Register::A));
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "EventScheduler.h"
+
+using namespace std;
+using namespace gbxcore;
+
+TEST(CoreTests_EventScheduler, EmptySchedulerHasNoPendingEvent)
+{
+    EventScheduler scheduler;
+
+    EXPECT_EQ(EventScheduler::NoPendingEvent, scheduler.NextEventCycle());
+    EXPECT_EQ(0llu, scheduler.PendingEventCount());
+
+    scheduler.RunDue(1000);
+    EXPECT_EQ(EventScheduler::NoPendingEvent, scheduler.NextEventCycle());
+}
+
+TEST(CoreTests_EventScheduler, EventsFireInCycleOrder)
+{
+    EventScheduler scheduler;
+    vector<uint64_t> fired;
+
+    for (auto cycle : {300llu, 100llu, 200llu, 100llu})
+        scheduler.Schedule(cycle, [&fired](uint64_t at) { fired.push_back(at); });
+
+    EXPECT_EQ(100llu, scheduler.NextEventCycle());
+
+    scheduler.RunDue(99);
+    EXPECT_TRUE(fired.empty());
+
+    scheduler.RunDue(250);
+    ASSERT_EQ(3llu, fired.size());
+    EXPECT_EQ(100llu, fired[0]);
+    EXPECT_EQ(100llu, fired[1]);
+    EXPECT_EQ(200llu, fired[2]);
+    EXPECT_EQ(300llu, scheduler.NextEventCycle());
+
+    scheduler.RunDue(300);
+    EXPECT_EQ(300llu, fired[3]);
+    EXPECT_EQ(EventScheduler::NoPendingEvent, scheduler.NextEventCycle());
+}
+
+TEST(CoreTests_EventScheduler, EventsDueAtTheSameCycleFireInScheduleOrder)
+{
+    EventScheduler scheduler;
+    vector<int> fired;
+
+    for (auto event = 0; event < 8; ++event)
+        scheduler.Schedule(50, [&fired, event](uint64_t) { fired.push_back(event); });
+
+    scheduler.RunDue(50);
+    EXPECT_EQ((vector<int>{0, 1, 2, 3, 4, 5, 6, 7}), fired);
+}
+
+TEST(CoreTests_EventScheduler, CancelledEventsDoNotFire)
+{
+    EventScheduler scheduler;
+    auto fired = 0;
+
+    auto first = scheduler.Schedule(10, [&fired](uint64_t) { fired += 1; });
+    scheduler.Schedule(20, [&fired](uint64_t) { fired += 10; });
+
+    scheduler.Cancel(first);
+    scheduler.Cancel(first);
+    EXPECT_EQ(20llu, scheduler.NextEventCycle());
+    EXPECT_EQ(1llu, scheduler.PendingEventCount());
+
+    scheduler.RunDue(100);
+    EXPECT_EQ(10, fired);
+}
+
+TEST(CoreTests_EventScheduler, EventsCanReschedule)
+{
+    EventScheduler scheduler;
+    vector<uint64_t> fired;
+    ScheduledEvent periodic = [&](uint64_t at)
+    {
+        fired.push_back(at);
+        scheduler.Schedule(at + 114, periodic);
+    };
+
+    scheduler.Schedule(63, periodic);
+    scheduler.RunDue(400);
+
+    EXPECT_EQ((vector<uint64_t>{63, 177, 291}), fired);
+    EXPECT_EQ(405llu, scheduler.NextEventCycle());
+}
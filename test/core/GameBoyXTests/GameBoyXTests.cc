@@ -2,6 +2,9 @@
 #include <gmock/gmock.h>
 
 #include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
 #include <thread>
 #include <memory>
 
@@ -88,9 +91,15 @@ TEST(CoreTests_GameBoyXTests, LoadGameMultipleBankGame)
         EXPECT_EQ(fileContent[i], get<uint8_t>(gbx.ReadROM(static_cast<uint16_t>(i), nullopt, MemoryAccessType::Byte)));
     
     // Check dynamic bank 1-128
-    for (auto j = 0llu; j < (size - DMGBCROMBankSize)/DMGBCROMBankSize; ++j)
+    for (auto j = 1llu; j < size/DMGBCROMBankSize; ++j)
         for (auto i = DMGBCBankedROMInitialAddress; i < DMGBCBankedROMFinalAddress; ++i)
-            EXPECT_EQ(fileContent[DMGBCROMBankSize*j + i], get<uint8_t>(gbx.ReadROM(static_cast<uint16_t>(i), j, MemoryAccessType::Byte)));
+            EXPECT_EQ(fileContent[DMGBCROMBankSize*(j - 1) + i], get<uint8_t>(gbx.ReadROM(static_cast<uint16_t>(i), j, MemoryAccessType::Byte)));
+
+    // The bank selected before the reads is still mapped
+    for (auto i = DMGBCBankedROMInitialAddress; i < DMGBCBankedROMFinalAddress; ++i)
+        EXPECT_EQ(fileContent[i], get<uint8_t>(gbx.ReadROM(static_cast<uint16_t>(i), nullopt, MemoryAccessType::Byte)));
+
+    EXPECT_THROW(gbx.ReadROM(static_cast<uint16_t>(DMGBCFixedROMInitialAddress), 1, MemoryAccessType::Byte), MemoryControllerException);
 }
 
 TEST(CoreTests_GameBoyXTests, LoadSystemBIOS)
@@ -125,6 +134,28 @@ TEST(CoreTests_GameBoyXTests, LoadTooLargeGameROM)
                       "Game ROM file larger than 2MB");    
 }
 
+TEST(CoreTests_GameBoyXTests, AttachSaveFile)
+{
+    const string saveName = "CoreTests_GameBoyXTests.sav";
+    filesystem::copy_file(GBXTestEnvironment::TestDataPath + "rom.sav", saveName, filesystem::copy_options::overwrite_existing);
+
+    {
+        GameBoyX gbx;
+        gbx.LoadGame(SampleMultipleGameFileName());
+        gbx.AttachSaveFile(saveName, chrono::milliseconds(1));
+    }
+
+    // The 64KB RAM image is mapped in place; the clock data stored after it is kept
+    EXPECT_EQ(65584llu, filesystem::file_size(saveName));
+    remove(saveName.c_str());
+
+    GameBoyX gbx;
+    gbx.LoadGame(SampleGameFileName());
+    ASSERT_EXCEPTION( { gbx.AttachSaveFile(saveName); }, 
+                      MemoryControllerException, 
+                      "Loaded game has no external RAM to save");
+}
+
 TEST(CoreTests_GameBoyXTests, ExecuteSystemBIOS)
 {
     // This test runs the instructions neeed to execute the 'Nintendo Logo checking' during the system bootup
@@ -286,4 +317,39 @@ TEST(CoreTests_GameBoyXTests, ExecuteSystemBIOSWithIncorrectROM)
         gbx.Run();
         EXPECT_EQ(0x0150, get<uint16_t>(gbx.ReadRegister(Register::PC)));
     }
-}
\ No newline at end of file
+}
+
+TEST(CoreTests_GameBoyXTests, RunInstructionsInBatch)
+{
+    GameBoyX gbx;
+    gbx.LoadBIOS(BIOSFileName());
+    gbx.LoadGame(SampleGameFileName());
+    gbx.SetSecurityLevel(SecurityLevel::System);
+
+    // NOP; LD HL, 0x0200; LD DE, 0x0104; LD C, 0x30
+    EXPECT_EQ(StopReason::BudgetExhausted, gbx.RunInstructions(4));
+    EXPECT_EQ(1llu + 3 + 3 + 2, gbx.Cycles());
+    EXPECT_EQ(0x0200, get<uint16_t>(gbx.ReadRegister(Register::HL)));
+    EXPECT_EQ(0x0104, get<uint16_t>(gbx.ReadRegister(Register::DE)));
+    EXPECT_EQ(0x30, get<uint8_t>(gbx.ReadRegister(Register::C)));
+}
+
+TEST(CoreTests_GameBoyXTests, RunUntilBreakpoint)
+{
+    GameBoyX gbx;
+    gbx.LoadBIOS(BIOSFileName());
+    gbx.LoadGame(SampleGameFileName());
+    gbx.SetSecurityLevel(SecurityLevel::System);
+
+    gbx.SetBreakpoint(0x0100);
+    EXPECT_EQ(StopReason::Breakpoint, gbx.RunFor(numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(0x0100, get<uint16_t>(gbx.ReadRegister(Register::PC)));
+    EXPECT_EQ(SecurityLevel::User, gbx.SecurityLevel());
+    EXPECT_EQ(0x00, get<uint8_t>(gbx.ReadRegister(Register::C)));
+
+    // Resuming executes the instruction at the breakpoint instead of stopping again
+    EXPECT_EQ(StopReason::BudgetExhausted, gbx.RunInstructions(1));
+    EXPECT_NE(0x0100, get<uint16_t>(gbx.ReadRegister(Register::PC)));
+
+    gbx.ClearBreakpoint(0x0100);
+}
@@ -16,7 +16,7 @@ OBJ_FILES = $(patsubst %.cc,$(BUILD_TEMP)/%.o,$(SRC_FILES))
 DEP_FILES = $(patsubst %.o,%.d,$(OBJ_FILES))
 
 # Add test dependencies here (.cc files only)
-MODULES = GameBoyX GBXCoreExceptions FileLoader MemoryController
+MODULES = GameBoyX GBXCoreExceptions FileLoader MappedFile MemoryController
 MODULES_DEPS = $(addsuffix .o, $(addprefix $(BUILD_TEMP)/,$(MODULES)))
 
 .PHONY: all
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "AddressRange.h"
+#include "AddressingMode.h"
+#include "ArithmeticLogicUnit.h"
+#include "ControlUnit.h"
+#include "InstructionCycles.h"
+#include "MemoryController.h"
+#include "Opcodes.h"
+#include "RAM.h"
+#include "RegisterBank.h"
+#include "SystemMode.h"
+#include "ThreadedControlUnit.h"
+
+using namespace std;
+using namespace gbxcore;
+using namespace gbxcore::instructions;
+using namespace gbxcore::memory;
+using namespace gbxcore::interfaces;
+
+typedef struct CycleCountingState_t
+{
+    RegisterBank Registers;
+    MemoryController Memory;
+    ArithmeticLogicUnit ALU;
+}
+CycleCountingState;
+
+void LoadCycleCountingProgram(CycleCountingState& state, vector<uint8_t> program)
+{
+    state.Memory.RegisterMemoryResource(make_unique<RAM>(0x2000), AddressRange(0x0000, 0x2000, RangeType::BeginInclusive), PrivilegeMode::System);
+    state.Memory.SetSecurityLevel(PrivilegeMode::System);
+
+    for (auto address = 0llu; address < program.size(); ++address)
+        state.Memory.Write(program[address], static_cast<uint16_t>(address));
+
+    state.ALU.Initialize(&state.Registers);
+}
+
+uint64_t CountCyclesUntilHalt(ControlUnitInterface& controlUnit, CycleCountingState& state)
+{
+    controlUnit.Initialize(&state.Memory, &state.ALU);
+
+    for (auto cycle = 0llu; cycle < 0x100 && !state.ALU.HaltSignal(); ++cycle)
+        controlUnit.RunCycle();
+
+    return state.ALU.Cycles();
+}
+
+const vector<uint8_t> CycleCountingProgram =
+{
+    0x00,               // NOP              (1)
+    0x06, 0x01,         // LD B, 0x01       (2)
+    0x05,               // DEC B            (1)
+    0x20, 0x00,         // JR NZ, +0        (2, not taken)
+    0x28, 0x00,         // JR Z, +0         (3, taken)
+    0x21, 0x00, 0x10,   // LD HL, 0x1000    (3)
+    0x34,               // INC (HL)         (3)
+    0x23,               // INC HL           (2)
+    0xCB, 0x37,         // SWAP A           (2)
+    0x76                // HALT             (1)
+};
+
+TEST(CoreTests_InstructionCycles, MachineCyclesPerOpcodeAndAddressingMode)
+{
+    auto cyclesOf = [](OpcodeType opcode, AddressingMode mode) { return InstructionCycleCosts[static_cast<size_t>(opcode)][static_cast<size_t>(mode)]; };
+
+    EXPECT_EQ(1, cyclesOf(OpcodeType::ld, AddressingMode::Register).Taken);
+    EXPECT_EQ(2, cyclesOf(OpcodeType::ld, AddressingMode::Immediate).Taken);
+    EXPECT_EQ(3, cyclesOf(OpcodeType::ld, AddressingMode::ImmediatePair).Taken);
+    EXPECT_EQ(2, cyclesOf(OpcodeType::ld, AddressingMode::RegisterIndirectSource).Taken);
+    EXPECT_EQ(2, cyclesOf(OpcodeType::ld, AddressingMode::RegisterIndirectDestination).Taken);
+    EXPECT_EQ(4, cyclesOf(OpcodeType::ld, AddressingMode::ExtendedSource).Taken);
+    EXPECT_EQ(4, cyclesOf(OpcodeType::ld, AddressingMode::ExtendedDestination).Taken);
+    EXPECT_EQ(5, cyclesOf(OpcodeType::ld, AddressingMode::ExtendedDestinationPair).Taken);
+    EXPECT_EQ(3, cyclesOf(OpcodeType::inc, AddressingMode::RegisterIndirectSourceAndDestination).Taken);
+    EXPECT_EQ(2, cyclesOf(OpcodeType::inc, AddressingMode::RegisterPair).Taken);
+    EXPECT_EQ(4, cyclesOf(OpcodeType::add, AddressingMode::SingleImmediatePair).Taken);
+    EXPECT_EQ(4, cyclesOf(OpcodeType::push, AddressingMode::RegisterIndirectDestinationPair).Taken);
+    EXPECT_EQ(3, cyclesOf(OpcodeType::pop, AddressingMode::RegisterIndirectSourcePair).Taken);
+    EXPECT_EQ(4, cyclesOf(OpcodeType::rst, AddressingMode::RegisterIndirectDestinationPair).Taken);
+    EXPECT_EQ(4, cyclesOf(OpcodeType::reti, AddressingMode::RegisterIndirectSourcePair).Taken);
+}
+
+TEST(CoreTests_InstructionCycles, MachineCyclesOfTakenAndNotTakenBranches)
+{
+    auto cyclesOf = [](OpcodeType opcode, AddressingMode mode) { return InstructionCycleCosts[static_cast<size_t>(opcode)][static_cast<size_t>(mode)]; };
+
+    EXPECT_EQ(4, cyclesOf(OpcodeType::jp, AddressingMode::ImmediatePair).Taken);
+    EXPECT_EQ(3, cyclesOf(OpcodeType::jp, AddressingMode::ImmediatePair).NotTaken);
+    EXPECT_EQ(3, cyclesOf(OpcodeType::jr, AddressingMode::Immediate).Taken);
+    EXPECT_EQ(2, cyclesOf(OpcodeType::jr, AddressingMode::Immediate).NotTaken);
+    EXPECT_EQ(6, cyclesOf(OpcodeType::call, AddressingMode::SubRoutineCall).Taken);
+    EXPECT_EQ(3, cyclesOf(OpcodeType::call, AddressingMode::SubRoutineCall).NotTaken);
+    EXPECT_EQ(4, cyclesOf(OpcodeType::ret, AddressingMode::RegisterIndirectSourcePair).Taken);
+    EXPECT_EQ(2, cyclesOf(OpcodeType::ret, AddressingMode::RegisterIndirectSourcePair).NotTaken);
+    EXPECT_EQ(1, cyclesOf(OpcodeType::jp, AddressingMode::RegisterIndirectSourcePair).Taken);
+    EXPECT_EQ(1, cyclesOf(OpcodeType::jp, AddressingMode::RegisterIndirectSourcePair).NotTaken);
+}
+
+TEST(CoreTests_InstructionCycles, ExecutedInstructionsAdvanceCycleCounter)
+{
+    CycleCountingState state;
+    LoadCycleCountingProgram(state, CycleCountingProgram);
+
+    ControlUnit controlUnit;
+    EXPECT_EQ(20llu, CountCyclesUntilHalt(controlUnit, state));
+}
+
+TEST(CoreTests_InstructionCycles, ThreadedInterpreterAccountsSameCycles)
+{
+    CycleCountingState state;
+    LoadCycleCountingProgram(state, CycleCountingProgram);
+
+    ThreadedControlUnit controlUnit;
+    EXPECT_EQ(20llu, CountCyclesUntilHalt(controlUnit, state));
+}
+
+TEST(CoreTests_InstructionCycles, ConditionalCallAndReturnCycles)
+{
+    vector<uint8_t> program =
+    {
+        0x31, 0x00, 0x18,   // LD SP, 0x1800    (3)
+        0xAF,               // XOR A            (1)
+        0xC4, 0x00, 0x10,   // CALL NZ, 0x1000  (3, not taken)
+        0xCC, 0x0B, 0x00,   // CALL Z, 0x000B   (6, taken)
+        0x76,               // HALT
+        0xC0,               // RET NZ           (2, not taken)
+        0xC8,               // RET Z            (5, taken)
+    };
+
+    CycleCountingState state;
+    LoadCycleCountingProgram(state, program);
+
+    ControlUnit controlUnit;
+    EXPECT_EQ(3llu + 1 + 3 + 6 + 2 + 5 + 1, CountCyclesUntilHalt(controlUnit, state));
+    EXPECT_EQ(0x1800, state.Registers.ReadPair(Register::SP));
+}
+
+TEST(CoreTests_InstructionCycles, UnconditionalReturnAndRegisterJumpCycles)
+{
+    vector<uint8_t> program =
+    {
+        0x31, 0x00, 0x18,   // LD SP, 0x1800    (3)
+        0xCD, 0x08, 0x00,   // CALL 0x0008      (6)
+        0xE9,               // JP (HL)          (1)
+        0x00,               // NOP
+        0xC9,               // RET              (4)
+    };
+
+    CycleCountingState state;
+    LoadCycleCountingProgram(state, program);
+
+    ControlUnit controlUnit;
+    controlUnit.Initialize(&state.Memory, &state.ALU);
+
+    for (auto instruction = 0; instruction < 3; ++instruction)
+        controlUnit.RunCycle();
+
+    EXPECT_EQ(0x0006, state.Registers.ReadPair(Register::PC));
+    EXPECT_EQ(3llu + 6 + 4, state.ALU.Cycles());
+
+    state.Registers.WritePair(Register::HL, 0x0007);
+    controlUnit.RunCycle();
+
+    EXPECT_EQ(3llu + 6 + 4 + 1, state.ALU.Cycles());
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GBXCoreExceptions.h"
+#include "InstructionTrace.h"
+
+using namespace std;
+using namespace gbxcore;
+
+TEST(CoreTests_InstructionTrace, RingDropsRecordsWhenFull)
+{
+    auto ring = make_unique<TraceRing>();
+
+    for (auto i = 0llu; i < TraceRing::Capacity; ++i)
+        EXPECT_TRUE(ring->Push({i, static_cast<uint16_t>(i), 0x00, 0x00, 0}));
+
+    EXPECT_FALSE(ring->Push({TraceRing::Capacity, 0x0000, 0x00, 0x00, 0}));
+    EXPECT_EQ(1llu, ring->Dropped());
+
+    vector<TraceRecord> records;
+    EXPECT_EQ(TraceRing::Capacity, ring->Drain(records));
+    EXPECT_EQ(0llu, records.front().Cycle);
+    EXPECT_EQ(TraceRing::Capacity - 1, records.back().Cycle);
+
+    EXPECT_TRUE(ring->Push({0xAA, 0x0150, 0xCB, 0x37, 0}));
+    records.clear();
+    EXPECT_EQ(1llu, ring->Drain(records));
+    EXPECT_EQ(0x0150, records[0].Address);
+}
+
+TEST(CoreTests_InstructionTrace, RecordedTraceIsDecodedFromFile)
+{
+    const string traceName = "CoreTests_InstructionTrace.trace";
+    const auto recordsPerThread = 0x1000llu;
+    auto& tracer = InstructionTracer::Instance();
+
+    tracer.Start(traceName, chrono::milliseconds(1));
+    EXPECT_TRUE(tracer.IsRecording());
+
+    auto emulate = [&](uint8_t opcode)
+    {
+        for (auto cycle = 0llu; cycle < recordsPerThread; ++cycle)
+            tracer.Record({cycle, static_cast<uint16_t>(cycle), 0x00, opcode, 0});
+    };
+
+    thread secondCore(emulate, 0x01);
+    emulate(0x00);
+    secondCore.join();
+    tracer.Stop();
+
+    TraceFileReader reader(traceName);
+    auto records = reader.ReadAll();
+    remove(traceName.c_str());
+
+    EXPECT_EQ(2 * recordsPerThread - tracer.Dropped(), records.size());
+
+    array<uint64_t, 2> nextCycle{};
+    for (auto& record : records)
+    {
+        // Records of a core keep their order, whatever the interleaving between cores
+        EXPECT_LE(nextCycle[record.Opcode], record.Cycle);
+        nextCycle[record.Opcode] = record.Cycle + 1;
+    }
+}
+
+TEST(CoreTests_InstructionTrace, ReaderRejectsNonTraceFile)
+{
+    const string fileName = "CoreTests_InstructionTrace.txt";
+    ofstream file(fileName);
+    file << "PC: 100 : 0 31" << '\n';
+    file.close();
+
+    ASSERT_THROW(TraceFileReader reader(fileName), TraceException);
+    remove(fileName.c_str());
+}
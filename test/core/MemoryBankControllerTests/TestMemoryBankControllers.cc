@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "AddressRange.h"
+#include "BankedRAM.h"
+#include "BankedROM.h"
+#include "MemoryBankControllers.h"
+#include "MemoryController.h"
+#include "MemoryObserver.h"
+#include "ROM.h"
+#include "SystemMode.h"
+
+using namespace std;
+using namespace gbxcore;
+using namespace gbxcore::memory;
+using namespace gbxcore::interfaces;
+
+shared_ptr<const uint8_t> MBCTestROMContent(size_t bankCount, size_t bankSize)
+{
+    auto content = make_shared<vector<uint8_t>>(bankCount * bankSize);
+
+    for (auto bank = 0llu; bank < bankCount; ++bank)
+        fill_n(content->begin() + static_cast<ptrdiff_t>(bank * bankSize), bankSize, static_cast<uint8_t>(bank));
+
+    return shared_ptr<const uint8_t>(content, content->data());
+}
+
+// Cartridge-like memory map: fixed ROM bank, switchable ROM bank (8 banks) and switchable external RAM (4 banks)
+void RegisterMBCTestCartridge(MemoryController& memory, MemoryBankControllerType type)
+{
+    auto rom = make_unique<BankedROM>(8 * 0x4000, 0x4000);
+    auto ram = make_unique<BankedRAM>(4 * 0x2000, 0x2000);
+    auto romPointer = rom.get();
+    auto ramPointer = ram.get();
+
+    memory.RegisterMemoryResource(make_unique<ROM>(0x4000), AddressRange(0x0000, 0x4000, RangeType::BeginInclusive), PrivilegeMode::User);
+    memory.RegisterMemoryResource(std::move(rom), AddressRange(0x4000, 0x8000, RangeType::BeginInclusive), PrivilegeMode::User);
+    memory.RegisterMemoryResource(std::move(ram), AddressRange(0xA000, 0xC000, RangeType::BeginInclusive), PrivilegeMode::User);
+    memory.SetSecurityLevel(PrivilegeMode::User);
+    memory.Map(MBCTestROMContent(8, 0x4000), 8 * 0x4000, 0x4000);
+    memory.SetMemoryBankController(CreateMemoryBankController(type, romPointer, ramPointer, 4), PrivilegeMode::User);
+}
+
+class BankSwitchRecorder : public MemoryObserver
+{
+public:
+    void OnWrite(size_t) override {}
+    void OnBankSwitch(PrivilegeMode, AddressRange range, size_t bank) override { Switches.push_back({range.Begin(), bank}); }
+    void OnInvalidate() override {}
+
+    vector<pair<size_t, size_t>> Switches;
+};
+
+TEST(CoreTests_MemoryBankControllers, ControllerTypeFromCartridgeHeader)
+{
+    EXPECT_EQ(MemoryBankControllerType::None, MemoryBankControllerTypeOf(0x00));
+    EXPECT_EQ(MemoryBankControllerType::MBC1, MemoryBankControllerTypeOf(0x03));
+    EXPECT_EQ(MemoryBankControllerType::MBC3, MemoryBankControllerTypeOf(0x10));
+    EXPECT_EQ(MemoryBankControllerType::MBC5, MemoryBankControllerTypeOf(0x1B));
+    EXPECT_EQ(MemoryBankControllerType::Unsupported, MemoryBankControllerTypeOf(0x05));
+
+    EXPECT_EQ(0llu, ExternalRAMBankCount(0x00));
+    EXPECT_EQ(1llu, ExternalRAMBankCount(0x02));
+    EXPECT_EQ(4llu, ExternalRAMBankCount(0x03));
+    EXPECT_EQ(8llu, ExternalRAMBankCount(0x05));
+
+    EXPECT_EQ(nullptr, CreateMemoryBankController(MemoryBankControllerType::None, nullptr, nullptr, 0));
+}
+
+TEST(CoreTests_MemoryBankControllers, ROMBankSwitchThroughControlWrites)
+{
+    MemoryController memory;
+    RegisterMBCTestCartridge(memory, MemoryBankControllerType::MBC1);
+
+    EXPECT_EQ(0x01, memory.ReadByte(0x4000));
+
+    memory.WriteByte(0x03, 0x2000);
+    EXPECT_EQ(0x03, memory.ReadByte(0x4000));
+    EXPECT_EQ(0x0303, memory.ReadWord(0x7FFE));
+    EXPECT_EQ(0x03llu, memory.BankController()->ROMBank());
+
+    memory.WriteByte(0x00, 0x2000);
+    EXPECT_EQ(0x01, memory.ReadByte(0x4000));
+
+    // Bank numbers wrap around the banks present in the cartridge
+    memory.WriteByte(0x0A, 0x3FFF);
+    EXPECT_EQ(0x02, memory.ReadByte(0x5000));
+}
+
+TEST(CoreTests_MemoryBankControllers, ExternalRAMRequiresEnabling)
+{
+    MemoryController memory;
+    RegisterMBCTestCartridge(memory, MemoryBankControllerType::MBC1);
+
+    memory.WriteByte(0x12, 0xA000);
+    EXPECT_EQ(0xFF, memory.ReadByte(0xA000));
+
+    memory.WriteByte(0x0A, 0x0000);
+    memory.WriteByte(0x12, 0xA000);
+    EXPECT_EQ(0x12, memory.ReadByte(0xA000));
+
+    // RAM banking mode, bank 2
+    memory.WriteByte(0x01, 0x6000);
+    memory.WriteByte(0x02, 0x4000);
+    EXPECT_EQ(0x00, memory.ReadByte(0xA000));
+    EXPECT_EQ(0x02llu, memory.BankController()->RAMBank());
+
+    memory.WriteByte(0x00, 0x4000);
+    EXPECT_EQ(0x12, memory.ReadByte(0xA000));
+
+    memory.WriteByte(0x00, 0x0000);
+    EXPECT_EQ(0xFF, memory.ReadByte(0xA000));
+}
+
+TEST(CoreTests_MemoryBankControllers, ObserversNotifiedOfControlledBankSwitches)
+{
+    MemoryController memory;
+    BankSwitchRecorder recorder;
+    RegisterMBCTestCartridge(memory, MemoryBankControllerType::MBC5);
+    memory.RegisterMemoryObserver(&recorder);
+
+    memory.WriteByte(0x05, 0x2000);
+    memory.WriteByte(0x05, 0x2000);
+    memory.WriteByte(0x0A, 0x0000);
+    memory.WriteByte(0x03, 0x4000);
+
+    ASSERT_EQ(2llu, recorder.Switches.size());
+    EXPECT_EQ(0x4000llu, recorder.Switches[0].first);
+    EXPECT_EQ(0x05llu, recorder.Switches[0].second);
+    EXPECT_EQ(0xA000llu, recorder.Switches[1].first);
+    EXPECT_EQ(0x03llu, recorder.Switches[1].second);
+}
+
+TEST(CoreTests_MemoryBankControllers, MBC1UpperBitsExtendROMBank)
+{
+    BankedROM rom(0x80 * 0x10, 0x10);
+    MBC1 controller(&rom, nullptr, 0);
+
+    controller.Write(0x2000, 0x01);
+    controller.Write(0x4000, 0x02);
+    EXPECT_EQ(0x41llu, controller.ROMBank());
+    EXPECT_EQ(0x41llu, rom.CurrentBank());
+
+    controller.Write(0x2000, 0x20);
+    EXPECT_EQ(0x41llu, controller.ROMBank());
+    EXPECT_FALSE(controller.IsRAMEnabled());
+}
+
+TEST(CoreTests_MemoryBankControllers, MBC3ClockSelectionUnmapsRAM)
+{
+    BankedROM rom(0x80 * 0x10, 0x10);
+    BankedRAM ram(4 * 0x10, 0x10);
+    MBC3 controller(&rom, &ram, 4);
+
+    controller.Write(0x2000, 0x7F);
+    EXPECT_EQ(0x7Fllu, controller.ROMBank());
+
+    controller.Write(0x0000, 0x0A);
+    EXPECT_TRUE(ram.IsEnabled());
+
+    controller.Write(0x4000, 0x08);
+    EXPECT_FALSE(controller.IsRAMEnabled());
+    EXPECT_EQ(nullptr, ram.Data());
+
+    controller.Write(0x4000, 0x01);
+    EXPECT_TRUE(controller.IsRAMEnabled());
+    EXPECT_EQ(0x01llu, ram.CurrentBank());
+}
+
+TEST(CoreTests_MemoryBankControllers, MBC5NineBitROMBankNumber)
+{
+    BankedROM rom(0x200 * 0x10, 0x10);
+    MBC5 controller(&rom, nullptr, 0);
+
+    controller.Write(0x2000, 0x00);
+    EXPECT_EQ(0x00llu, controller.ROMBank());
+
+    controller.Write(0x3000, 0x01);
+    controller.Write(0x2000, 0x05);
+    EXPECT_EQ(0x105llu, controller.ROMBank());
+    EXPECT_EQ(0x105llu, rom.CurrentBank());
+}
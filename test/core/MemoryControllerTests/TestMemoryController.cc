@@ -4,8 +4,10 @@
 #include "TestUtils.h"
 
 #include <iostream>
+#include <vector>
 
 #include "AddressRange.h"
+#include "BankedROM.h"
 #include "MemoryController.h"
 #include "MemoryControllerInterface.h"
 #include "RAM.h"
@@ -523,4 +525,255 @@ TEST(CoreTests_MemoryController, ChangeMemoryMapMode)
         auto userValue = memController.Read(static_cast<uint16_t>(i), MemoryAccessType::Byte);
         EXPECT_EQ(*(userContent.begin() + i), get<uint8_t>(userValue));
     }
-}
\ No newline at end of file
+}
+
+TEST(CoreTests_MemoryController, SwitchBankOfBankedResource) 
+{
+    array<uint8_t, 0x10> bank0Content = {0xAA, 0xAA, 0xAA, 0xAA, 
+                                         0xAA, 0xAA, 0xAA, 0xAA, 
+                                         0xAA, 0xAA, 0xAA, 0xAA, 
+                                         0xAA, 0xAA, 0xAA, 0xAA};
+
+    array<uint8_t, 0x10> bank1Content = {0xBB, 0xBB, 0xBB, 0xBB, 
+                                         0xBB, 0xBB, 0xBB, 0xBB, 
+                                         0xBB, 0xBB, 0xBB, 0xBB, 
+                                         0xBB, 0xBB, 0xBB, 0xBB};
+
+    MemoryController memController;
+    memController.RegisterMemoryResource
+    (
+        make_unique<BankedROM>(0x20, 0x10),
+        AddressRange(0x0100, 0x0110, RangeType::BeginInclusive),
+        PrivilegeMode::System
+    );
+
+    memController.RegisterMemoryResource
+    (
+        make_unique<RAM>(0x10),
+        AddressRange(0x0200, 0x0210, RangeType::BeginInclusive),
+        PrivilegeMode::System
+    );
+
+    memController.Load(make_unique<uint8_t*>(bank0Content.data()), bank0Content.size(), 0x0100, nullopt);
+    memController.SwitchBank(0x0100, 1);
+    memController.Load(make_unique<uint8_t*>(bank1Content.data()), bank1Content.size(), 0x0100, nullopt);
+
+    EXPECT_EQ(0xBB, get<uint8_t>(memController.Read(0x0105, MemoryAccessType::Byte)));
+    memController.SwitchBank(0x0100, 0);
+    EXPECT_EQ(0xAA, get<uint8_t>(memController.Read(0x0105, MemoryAccessType::Byte)));
+
+    ASSERT_THROW(memController.SwitchBank(0x0200, 1), MemoryControllerException);
+}
+
+TEST(CoreTests_MemoryController, AccessesAcrossPageBoundaries) 
+{
+    MemoryController memController;
+    memController.RegisterMemoryResource
+    (
+        make_unique<RAM>(0x300),
+        AddressRange(0x0100, 0x0400, RangeType::BeginInclusive),
+        PrivilegeMode::System
+    );
+
+    memController.Write(static_cast<uint16_t>(0xBEEF), 0x01FF);
+    EXPECT_EQ(0xEF, get<uint8_t>(memController.Read(0x01FF, MemoryAccessType::Byte)));
+    EXPECT_EQ(0xBE, get<uint8_t>(memController.Read(0x0200, MemoryAccessType::Byte)));
+    EXPECT_EQ(0xBEEF, get<uint16_t>(memController.Read(0x01FF, MemoryAccessType::Word)));
+
+    ASSERT_THROW(static_cast<void>(memController.Read(0x03FF, MemoryAccessType::Word)), MemoryAccessException);
+    ASSERT_THROW(static_cast<void>(memController.Read(0x0400, MemoryAccessType::Byte)), MemoryControllerException);
+}
+
+TEST(CoreTests_MemoryController, ResourcesSharingAPage) 
+{
+    MemoryController memController;
+    memController.RegisterMemoryResource
+    (
+        make_unique<RAM>(0x80),
+        AddressRange(0xFF00, 0xFF80, RangeType::BeginInclusive),
+        PrivilegeMode::User
+    );
+
+    memController.RegisterMemoryResource
+    (
+        make_unique<ROM>(0x7F),
+        AddressRange(0xFF80, 0xFFFF, RangeType::BeginInclusive),
+        PrivilegeMode::User
+    );
+
+    memController.SetSecurityLevel(PrivilegeMode::User);
+    memController.Write(static_cast<uint8_t>(0x12), 0xFF7F);
+
+    EXPECT_EQ(0x12, get<uint8_t>(memController.Read(0xFF7F, MemoryAccessType::Byte)));
+    EXPECT_EQ(0x00, get<uint8_t>(memController.Read(0xFF80, MemoryAccessType::Byte)));
+    ASSERT_THROW(memController.Write(static_cast<uint8_t>(0x12), 0xFF80), MemoryAccessException);
+    ASSERT_THROW(static_cast<void>(memController.Read(0xFFFF, MemoryAccessType::Byte)), MemoryControllerException);
+
+    memController.SetSecurityLevel(PrivilegeMode::System);
+    ASSERT_THROW(static_cast<void>(memController.Read(0xFF7F, MemoryAccessType::Byte)), MemoryControllerException);
+}
+
+TEST(CoreTests_MemoryController, UnregisteredResourceIsRemovedFromMemoryMap) 
+{
+    MemoryController memController;
+    auto id = memController.RegisterMemoryResource
+    (
+        make_unique<RAM>(0x1000),
+        AddressRange(0x1000, 0x2000, RangeType::BeginInclusive),
+        PrivilegeMode::System
+    );
+
+    memController.Write(static_cast<uint8_t>(0x34), 0x1800);
+    EXPECT_EQ(0x34, get<uint8_t>(memController.Read(0x1800, MemoryAccessType::Byte)));
+
+    memController.UnregisterMemoryResource(id, PrivilegeMode::System);
+    ASSERT_THROW(static_cast<void>(memController.Read(0x1800, MemoryAccessType::Byte)), MemoryControllerException);
+    ASSERT_THROW(memController.Write(static_cast<uint8_t>(0x34), 0x1800), MemoryControllerException);
+}
+
+TEST(CoreTests_MemoryController, TypedAccessorsMatchVariantAccessors) 
+{
+    MemoryController memController;
+    memController.RegisterMemoryResource
+    (
+        make_unique<RAM>(0x200),
+        AddressRange(0x0100, 0x0300, RangeType::BeginInclusive),
+        PrivilegeMode::System
+    );
+
+    memController.WriteWord(0xCAFE, 0x01FF);
+    memController.WriteByte(0x42, 0x0250);
+
+    EXPECT_EQ(0xCAFE, memController.ReadWord(0x01FF));
+    EXPECT_EQ(0xFE, memController.ReadByte(0x01FF));
+    EXPECT_EQ(0x42, get<uint8_t>(memController.Read(0x0250, MemoryAccessType::Byte)));
+    EXPECT_EQ(0xCAFE, get<uint16_t>(memController.Read(0x01FF, MemoryAccessType::Word)));
+    ASSERT_THROW(static_cast<void>(memController.ReadByte(0x0300)), MemoryControllerException);
+}
+
+TEST(CoreTests_MemoryController, FaultPolicies) 
+{
+    MemoryController memController;
+    memController.RegisterMemoryResource
+    (
+        make_unique<ROM>(0x100),
+        AddressRange(0x0000, 0x0100, RangeType::BeginInclusive),
+        PrivilegeMode::System
+    );
+
+    EXPECT_EQ(MemoryFaultPolicy::Throw, memController.FaultPolicy());
+    ASSERT_THROW(static_cast<void>(memController.ReadByte(0x1000)), MemoryControllerException);
+    ASSERT_THROW(memController.WriteByte(0x12, 0x1000), MemoryControllerException);
+    ASSERT_THROW(memController.WriteByte(0x12, 0x0010), MemoryAccessException);
+
+    memController.SetFaultPolicy(MemoryFaultPolicy::OpenBus);
+    EXPECT_EQ(0xFF, memController.ReadByte(0x1000));
+    EXPECT_EQ(0xFFFF, memController.ReadWord(0x10FF));
+    EXPECT_NO_THROW(memController.WriteByte(0x12, 0x1000));
+    EXPECT_NO_THROW(memController.WriteByte(0x12, 0x0010));
+    EXPECT_EQ(0x00, memController.ReadByte(0x0010));
+    EXPECT_EQ(0xFF00, memController.ReadWord(0x00FF));
+}
+
+TEST(CoreTests_MemoryController, ReadThroughAnotherPrivilegeView) 
+{
+    MemoryController memController;
+    memController.RegisterMemoryResource
+    (
+        make_unique<RAM>(0x100),
+        AddressRange(0x0000, 0x0100, RangeType::BeginInclusive),
+        PrivilegeMode::System
+    );
+
+    memController.RegisterMemoryResource
+    (
+        make_unique<RAM>(0x100),
+        AddressRange(0x0000, 0x0100, RangeType::BeginInclusive),
+        PrivilegeMode::User
+    );
+
+    memController.SetSecurityLevel(PrivilegeMode::User);
+    memController.WriteByte(0x55, 0x0010);
+    memController.SetSecurityLevel(PrivilegeMode::System);
+    memController.WriteByte(0xAA, 0x0010);
+
+    EXPECT_EQ(0x55, memController.ReadByteAs(PrivilegeMode::User, 0x0010));
+    EXPECT_EQ(0x55, memController.ReadByteAs(PrivilegeMode::Both, 0x0010));
+    EXPECT_EQ(0xAA, memController.ReadByteAs(PrivilegeMode::System, 0x0010));
+    EXPECT_EQ(PrivilegeMode::System, memController.SecurityLevel());
+    EXPECT_EQ(0xAA, memController.ReadByte(0x0010));
+}
+
+TEST(CoreTests_MemoryController, BlockTransfersAcrossPages) 
+{
+    MemoryController memController;
+    memController.RegisterMemoryResource
+    (
+        make_unique<RAM>(0x300),
+        AddressRange(0x0100, 0x0400, RangeType::BeginInclusive),
+        PrivilegeMode::System
+    );
+
+    vector<uint8_t> content(0x180);
+    for (auto i = 0llu; i < content.size(); ++i)
+        content[i] = static_cast<uint8_t>(i);
+
+    memController.WriteBlock(content, 0x01C0);
+    EXPECT_EQ(0x40, memController.ReadByte(0x0200));
+    EXPECT_EQ(0x7F, memController.ReadByte(0x033F));
+
+    vector<uint8_t> readBack(content.size());
+    memController.ReadBlock(0x01C0, readBack);
+    EXPECT_EQ(content, readBack);
+
+    // Overlapping copies behave as if the whole source was read first
+    memController.CopyBlock(0x01C0, 0x01C1, 0x100);
+    EXPECT_EQ(0x00, memController.ReadByte(0x01C1));
+    EXPECT_EQ(0xFF, memController.ReadByte(0x02C0));
+
+    memController.CopyBlock(0x01C1, 0x0100, 0x10);
+    EXPECT_EQ(0x00, memController.ReadByte(0x0100));
+    EXPECT_EQ(0x0F, memController.ReadByte(0x010F));
+
+    ASSERT_THROW(memController.ReadBlock(0x03F0, readBack), MemoryControllerException);
+}
+
+TEST(CoreTests_MemoryController, BlockTransfersThroughViewsAndReadOnlyPages) 
+{
+    MemoryController memController;
+    memController.RegisterMemoryResource
+    (
+        make_unique<ROM>(0x100),
+        AddressRange(0x0000, 0x0100, RangeType::BeginInclusive),
+        PrivilegeMode::User
+    );
+
+    memController.RegisterMemoryResource
+    (
+        make_unique<RAM>(0x100),
+        AddressRange(0x0100, 0x0200, RangeType::BeginInclusive),
+        PrivilegeMode::User
+    );
+
+    vector<uint8_t> content(0x20, 0x5A);
+    memController.SetSecurityLevel(PrivilegeMode::User);
+    memController.WriteBlock(content, 0x0100);
+
+    ASSERT_THROW(memController.WriteBlock(content, 0x00F0), MemoryAccessException);
+    ASSERT_THROW(memController.CopyBlock(0x0100, 0x0000, 0x10), MemoryAccessException);
+
+    memController.SetFaultPolicy(MemoryFaultPolicy::OpenBus);
+    memController.CopyBlock(0x0100, 0x0000, 0x10);
+    EXPECT_EQ(0x00, memController.ReadByte(0x0000));
+
+    memController.CopyBlock(0x0000, 0x0110, 0x20);
+    EXPECT_EQ(0x00, memController.ReadByte(0x0110));
+    EXPECT_EQ(0x5A, memController.ReadByte(0x010F));
+
+    // The System view has nothing mapped there
+    memController.SetSecurityLevel(PrivilegeMode::System);
+    vector<uint8_t> readBack(0x10);
+    memController.ReadBlock(0x0100, readBack);
+    EXPECT_EQ(vector<uint8_t>(0x10, 0xFF), readBack);
+}
+
@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <variant>
+#include <vector>
 
 #include "DMGAndGBCRegisterAddresses.h"
 #include "InterruptEnableRegister.h"
@@ -181,3 +182,49 @@ TEST(CoreTests_MemoryMappedRegister, UnregisterUnexistentMemoryMappedRegister)
                       MemoryControllerException, 
                       "Register '65535' has not been registered");
 }
+
+TEST(CoreTests_MemoryMappedRegister, IOPageRegistersArePrivilegeSpecific) 
+{
+    MemoryController controller;
+
+    controller.RegisterMemoryResource(make_unique<RAM>(0x80), AddressRange(0xFF00, 0xFF80, RangeType::BeginInclusive), PrivilegeMode::System);
+    controller.RegisterMemoryResource(make_unique<RAM>(0x80), AddressRange(0xFF00, 0xFF80, RangeType::BeginInclusive), PrivilegeMode::User);
+    controller.RegisterMemoryMappedRegister(make_unique<InterruptEnableRegister>(), 0xFF40, PrivilegeMode::System);
+    controller.RegisterMemoryMappedRegister(make_unique<InterruptEnableRegister>(), 0xFF41, PrivilegeMode::Both);
+
+    controller.Write(static_cast<uint8_t>(0xAA), 0xFF40);
+    controller.Write(static_cast<uint8_t>(0xBB), 0xFF41);
+    controller.Write(static_cast<uint8_t>(0xCC), 0xFF42);
+
+    controller.SetSecurityLevel(SecurityLevel::User);
+    controller.Write(static_cast<uint8_t>(0x11), 0xFF40);
+    EXPECT_EQ(get<uint8_t>(controller.Read(0xFF40, MemoryAccessType::Byte)), static_cast<uint8_t>(0x11));
+    EXPECT_EQ(get<uint8_t>(controller.Read(0xFF41, MemoryAccessType::Byte)), static_cast<uint8_t>(0xBB));
+    EXPECT_EQ(get<uint8_t>(controller.Read(0xFF42, MemoryAccessType::Byte)), static_cast<uint8_t>(0x00));
+
+    controller.SetSecurityLevel(SecurityLevel::System);
+    EXPECT_EQ(get<uint8_t>(controller.Read(0xFF40, MemoryAccessType::Byte)), static_cast<uint8_t>(0xAA));
+    EXPECT_EQ(get<uint8_t>(controller.Read(0xFF42, MemoryAccessType::Byte)), static_cast<uint8_t>(0xCC));
+
+    controller.UnregisterMemoryMappedRegister(0xFF40, PrivilegeMode::System);
+    EXPECT_EQ(get<uint8_t>(controller.Read(0xFF40, MemoryAccessType::Byte)), static_cast<uint8_t>(0x00));
+}
+
+TEST(CoreTests_MemoryMappedRegister, BlockTransfersGoThroughRegisters) 
+{
+    MemoryController controller;
+    controller.RegisterMemoryResource(make_unique<RAM>(0x100), AddressRange(0x0100, 0x0200, RangeType::BeginInclusive), PrivilegeMode::System);
+    controller.RegisterMemoryMappedRegister(make_unique<InterruptEnableRegister>(), 0x0190, PrivilegeMode::System);
+
+    vector<uint8_t> content(0x20);
+    for (auto i = 0llu; i < content.size(); ++i)
+        content[i] = static_cast<uint8_t>(0xA0 + i);
+
+    controller.WriteBlock(content, 0x0180);
+
+    vector<uint8_t> readBack(0x20);
+    controller.ReadBlock(0x0180, readBack);
+    EXPECT_EQ(content, readBack);
+    EXPECT_EQ(0xB0, get<uint8_t>(controller.Read(0x0190, MemoryAccessType::Byte)));
+}
+
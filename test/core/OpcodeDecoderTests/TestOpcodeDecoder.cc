@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include "CoreTestMocksAndWrappers.h"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "ArithmeticLogicUnit.h"
+#include "MemoryController.h"
+#include "OpcodeDecoder.h"
+#include "OpcodeDispatchTable.h"
+#include "Opcodes.h"
+#include "RegisterBank.h"
+
+using namespace std;
+using namespace gbxcore;
+using namespace gbxcore::interfaces;
+using namespace gbxcore::instructions;
+
+TEST(CoreTests_OpcodeDecoder, DispatchTablesAreBuiltAtCompileTime)
+{
+    static_assert(UnprefixedDispatchTable[0x00] == InstructionSlot::Nop);
+    static_assert(UnprefixedDispatchTable[0x76] == InstructionSlot::Halt);
+    static_assert(UnprefixedDispatchTable[0xC3] == InstructionSlot::Jp);
+    static_assert(UnprefixedDispatchTable[0xE2] == InstructionSlot::LdAndLdu);
+    static_assert(UnprefixedDispatchTable[0xE3] == InstructionSlot::Illegal);
+    static_assert(PrefixCBDispatchTable[0x37] == InstructionSlot::Swap);
+    static_assert(PrefixIndexedDispatchTable[0x46] == InstructionSlot::LdAndLdu);
+    static_assert(PrefixIndexedDispatchTable[0x00] == InstructionSlot::Illegal);
+    static_assert(PrefixFCDispatchTable[0xC3] == InstructionSlot::Jpu);
+
+    auto cbOpcodes = 0;
+    for (auto slot : PrefixCBDispatchTable)
+        cbOpcodes += (slot != InstructionSlot::Illegal)? 1 : 0;
+
+    EXPECT_EQ(0x100, cbOpcodes);
+}
+
+TEST(CoreTests_OpcodeDecoder, DecodeKnownOpcodes)
+{
+    OpcodeDecoder decoder;
+
+    EXPECT_NE(nullptr, dynamic_cast<InstructionNop*>(decoder.DecodeOpcode(0x00, nullopt)));
+    EXPECT_NE(nullptr, dynamic_cast<InstructionLdAndLdu*>(decoder.DecodeOpcode(0x41, nullopt)));
+    EXPECT_NE(nullptr, dynamic_cast<InstructionBit*>(decoder.DecodeOpcode(0x47, make_optional<uint8_t>(0xCB))));
+    EXPECT_NE(nullptr, dynamic_cast<InstructionLdAndLdu*>(decoder.DecodeOpcode(0x70, make_optional<uint8_t>(0xDD))));
+    EXPECT_NE(nullptr, dynamic_cast<InstructionLdAndLdu*>(decoder.DecodeOpcode(0x70, make_optional<uint8_t>(0xFD))));
+    EXPECT_NE(nullptr, dynamic_cast<InstructionJpu*>(decoder.DecodeOpcode(0xC3, make_optional<uint8_t>(0xFC))));
+}
+
+TEST(CoreTests_OpcodeDecoder, DecodeUnknownPrefixes)
+{
+    OpcodeDecoder decoder;
+
+    EXPECT_NE(nullptr, dynamic_cast<InstructionIllegal*>(decoder.DecodeOpcode(0x00, make_optional<uint8_t>(0xED))));
+    EXPECT_NE(nullptr, dynamic_cast<InstructionIllegal*>(decoder.DecodeOpcode(0x41, make_optional<uint8_t>(0x00))));
+}
+
+TEST(CoreTests_OpcodeDecoder, DecodeIllegalOpcodes)
+{
+    RegisterBank registerBank;
+    
+    ArithmeticLogicDecorator alu;
+    alu.Initialize(&registerBank);
+    alu.InitializeRegisters();
+
+    vector<uint8_t> illegalOpcodes = {0xE3, 0xE4, 0xEB, 0xEC, 0xED, 0xF4};
+
+    for (auto opcode : illegalOpcodes)
+    {
+        alu.DecodeInstruction(opcode, nullopt);
+
+        EXPECT_EQ(OpcodeType::illegal, alu.GetInstructionData().Opcode);
+        EXPECT_EQ(AddressingMode::Register, alu.GetInstructionData().AddressingMode);
+        EXPECT_EQ(opcode, alu.GetInstructionData().InstructionExtraOperand);
+
+        alu.Execute();
+        EXPECT_TRUE(alu.IllegalInstructionSignal());
+    }
+
+    alu.DecodeInstruction(0x00, nullopt);
+    alu.Execute();
+    EXPECT_FALSE(alu.IllegalInstructionSignal());
+}
\ No newline at end of file
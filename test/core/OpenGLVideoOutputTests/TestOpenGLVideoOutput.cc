@@ -143,7 +143,7 @@ public:
 
     gbxcore::interfaces::RGBColor* GBXFramePixels()
     {
-        return _gbxFramePixels;
+        return _gbxFramePixels.get();
     }
 
     virtual ~OpenGLVideoOutputWrapper() = default;
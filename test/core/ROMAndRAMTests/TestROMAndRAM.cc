@@ -305,4 +305,22 @@ TEST(CoreTests_ROMAndRAM, LoadOffsetOutOfBounds)
     }
 
     EXPECT_TRUE(testPassed);
-}
\ No newline at end of file
+}
+
+TEST(CoreTests_ROMAndRAM, TypedAccessors)
+{
+    RAM ram(static_cast<size_t>(0x10));
+
+    ram.WriteByte(0x12, 0x00);
+    ram.WriteWord(0xBEEF, 0x01);
+
+    EXPECT_EQ(0x12, ram.ReadByte(0x00));
+    EXPECT_EQ(0xEF, ram.ReadByte(0x01));
+    EXPECT_EQ(0xBEEF, ram.ReadWord(0x01));
+    EXPECT_EQ(0xBEEF, get<uint16_t>(ram.Read(0x01, MemoryAccessType::Word)));
+
+    ROM rom(static_cast<size_t>(0x10));
+    ASSERT_THROW(rom.WriteByte(0x12, 0x00), MemoryAccessException);
+    ASSERT_THROW(static_cast<void>(rom.ReadWord(0x0F)), MemoryAccessException);
+    ASSERT_THROW(ram.WriteWord(0xBEEF, 0x0F), MemoryAccessException);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+
+#include "ROMImageRegistry.h"
+
+using namespace std;
+using namespace gbxcore::memory;
+
+shared_ptr<const uint8_t> CreateRegistryTestContent(size_t size, uint8_t seed)
+{
+    shared_ptr<uint8_t[]> content(new uint8_t[size]);
+
+    for (auto i = static_cast<size_t>(0); i < size; ++i)
+        content[i] = static_cast<uint8_t>(seed + i);
+
+    return shared_ptr<const uint8_t>(content, content.get());
+}
+
+TEST(CoreTests_ROMImageRegistry, EqualContentSharesOneImage)
+{
+    auto& registry = ROMImageRegistry::Instance();
+    auto initialCount = registry.Count();
+
+    auto first = registry.Acquire(CreateRegistryTestContent(0x40, 0x10), 0x40, 0x20);
+    auto second = registry.Acquire(CreateRegistryTestContent(0x40, 0x10), 0x40, 0x20);
+    auto other = registry.Acquire(CreateRegistryTestContent(0x40, 0x11), 0x40, 0x20);
+
+    EXPECT_EQ(first.Data.get(), second.Data.get());
+    EXPECT_NE(first.Data.get(), other.Data.get());
+    EXPECT_EQ(0x40llu, first.Size);
+    EXPECT_EQ(initialCount + 2, registry.Count());
+}
+
+TEST(CoreTests_ROMImageRegistry, ImagesArePaddedToGranularity)
+{
+    auto& registry = ROMImageRegistry::Instance();
+    auto image = registry.Acquire(CreateRegistryTestContent(0x0A, 0x20), 0x0A, 0x10);
+
+    EXPECT_EQ(0x10llu, image.Size);
+    EXPECT_EQ(0x20, image.Data.get()[0x00]);
+    EXPECT_EQ(0x29, image.Data.get()[0x09]);
+
+    for (auto i = 0x0A; i < 0x10; ++i)
+        EXPECT_EQ(0x00, image.Data.get()[i]);
+}
+
+TEST(CoreTests_ROMImageRegistry, ImageIsReleasedWithItsLastUser)
+{
+    auto& registry = ROMImageRegistry::Instance();
+    auto initialCount = registry.Count();
+
+    auto content = CreateRegistryTestContent(0x20, 0x30);
+    weak_ptr<const uint8_t> observer = content;
+
+    {
+        auto image = registry.Acquire(content, 0x20, 0x20);
+        content.reset();
+        EXPECT_EQ(initialCount + 1, registry.Count());
+    }
+
+    EXPECT_TRUE(observer.expired());
+    EXPECT_EQ(initialCount, registry.Count());
+}
+
+TEST(CoreTests_ROMImageRegistry, HashIsFNV1a)
+{
+    array<uint8_t, 1> content = {'a'};
+
+    EXPECT_EQ(0xCBF29CE484222325llu, ROMImageRegistry::Hash(content.data(), 0));
+    EXPECT_EQ(0xAF63DC4C8601EC8Cllu, ROMImageRegistry::Hash(content.data(), 1));
+}
@@ -238,3 +238,79 @@ TEST(CoreTests_TestRegisterBank, TestFlags)
     for (auto flag : flags)
         EXPECT_EQ(0x01, bank.ReadFlag(flag));
 }
+
+
+uint8_t ExpectedFlags(FlagOperation operation, uint8_t operand1, uint8_t operand2, uint8_t carry)
+{
+    auto result = 0;
+    auto subtract = operation == FlagOperation::Subtract || operation == FlagOperation::Decrement;
+    auto carryIn = (operation == FlagOperation::Add || operation == FlagOperation::Subtract)? carry : 0;
+
+    switch (operation)
+    {
+        case FlagOperation::And: return ((operand1 & operand2) == 0? 0x80 : 0x00) | 0x20;
+        case FlagOperation::Or: return (operand1 | operand2) == 0? 0x80 : 0x00;
+        case FlagOperation::Xor: return (operand1 ^ operand2) == 0? 0x80 : 0x00;
+        default: result = subtract? operand1 - operand2 - carryIn : operand1 + operand2 + carryIn;
+    }
+
+    auto z = (result & 0xFF) == 0;
+    auto h = ((operand1 ^ operand2 ^ result) & 0x10) != 0;
+    auto cy = (operation == FlagOperation::Increment || operation == FlagOperation::Decrement)? carry != 0 : (result & 0x100) != 0;
+
+    return (z << 7) | (subtract << 6) | (h << 5) | (cy << 4);
+}
+
+TEST(CoreTests_TestRegisterBank, DeferredFlagsMatchArithmetic)
+{
+    RegisterBank lazy(FlagEvaluation::Lazy);
+    RegisterBank eager(FlagEvaluation::Eager);
+    auto operations = {FlagOperation::Add, FlagOperation::Subtract, FlagOperation::Increment, FlagOperation::Decrement,
+                       FlagOperation::And, FlagOperation::Or, FlagOperation::Xor};
+
+    for (auto operation : operations)
+        for (auto operand1 = 0; operand1 <= 0xFF; ++operand1)
+            for (auto operand2 = 0; operand2 <= 0xFF; ++operand2)
+                for (auto carry = 0; carry <= 1; ++carry)
+                {
+                    auto expected = ExpectedFlags(operation, operand1, operand2, carry);
+
+                    lazy.DeferFlags(operation, operand1, operand2, carry);
+                    EXPECT_EQ((expected >> 7) & 0x01, lazy.ReadFlag(Flag::Z));
+                    EXPECT_EQ((expected >> 6) & 0x01, lazy.ReadFlag(Flag::N));
+                    EXPECT_EQ((expected >> 5) & 0x01, lazy.ReadFlag(Flag::H));
+                    EXPECT_EQ((expected >> 4) & 0x01, lazy.ReadFlag(Flag::CY));
+                    EXPECT_EQ(expected, lazy.Read(Register::F));
+
+                    eager.DeferFlags(operation, operand1, operand2, carry);
+                    EXPECT_EQ(expected, eager.ReadPair(Register::AF) & 0xFF);
+                }
+}
+
+TEST(CoreTests_TestRegisterBank, DeferredFlagsAndFlagRegisterWrites)
+{
+    RegisterBank bank;
+
+    // Logical operations keep the lower nibble of F; arithmetic clears it
+    bank.Write(Register::F, 0x0F);
+    bank.DeferFlags(FlagOperation::Xor, 0x12, 0x12, 0x00);
+    EXPECT_EQ(0x8F, bank.Read(Register::F));
+
+    bank.DeferFlags(FlagOperation::Add, 0x0F, 0x01, 0x00);
+    EXPECT_EQ(0x20, bank.Read(Register::F));
+
+    // Overwriting F discards deferred flags
+    bank.DeferFlags(FlagOperation::Subtract, 0x00, 0x01, 0x00);
+    bank.Write(Register::F, 0x10);
+    EXPECT_EQ(0x00, bank.ReadFlag(Flag::Z));
+    EXPECT_EQ(0x01, bank.ReadFlag(Flag::CY));
+
+    bank.DeferFlags(FlagOperation::Subtract, 0x01, 0x01, 0x00);
+    bank.WritePair(Register::AF, 0x1230);
+    EXPECT_EQ(0x1230, bank.ReadPair(Register::AF));
+
+    // Single flag updates apply on top of the deferred operation
+    bank.DeferFlags(FlagOperation::Subtract, 0x01, 0x01, 0x00);
+    bank.SetFlag(Flag::CY);
+    EXPECT_EQ(0xD0, bank.Read(Register::F));
+}
@@ -0,0 +1,420 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "AddressRange.h"
+#include "ArithmeticLogicUnit.h"
+#include "BankedROM.h"
+#include "BasicBlockCache.h"
+#include "CGBHDMAAddressRegister.h"
+#include "CGBHDMAControlRegister.h"
+#include "ControlUnit.h"
+#include "MemoryBankControllers.h"
+#include "MemoryController.h"
+#include "RAM.h"
+#include "RegisterBank.h"
+#include "ROM.h"
+#include "SystemMode.h"
+#include "ThreadedControlUnit.h"
+#include "TieredControlUnit.h"
+
+using namespace std;
+using namespace gbxcore;
+using namespace gbxcore::memory;
+using namespace gbxcore::interfaces;
+using namespace gbxcore::constants;
+using namespace gbxcore::memory::registers;
+
+typedef struct EngineState_t
+{
+    RegisterBank Registers;
+    MemoryController Memory;
+    ArithmeticLogicUnit ALU;
+}
+EngineState;
+
+void LoadProgram(EngineState& state, vector<uint8_t> program)
+{
+    state.Memory.RegisterMemoryResource(make_unique<RAM>(0x2000), AddressRange(0x0000, 0x2000, RangeType::BeginInclusive), PrivilegeMode::System);
+    state.Memory.SetSecurityLevel(PrivilegeMode::System);
+
+    for (auto address = 0llu; address < program.size(); ++address)
+        state.Memory.Write(program[address], static_cast<uint16_t>(address));
+
+    state.ALU.Initialize(&state.Registers);
+}
+
+void RunUntilHalt(ControlUnitInterface& controlUnit, EngineState& state)
+{
+    controlUnit.Initialize(&state.Memory, &state.ALU);
+
+    for (auto cycle = 0llu; cycle < 0x100; ++cycle)
+    {
+        controlUnit.RunCycle();
+        if (state.ALU.HaltSignal())
+            return;
+    }
+
+    FAIL() << "program did not halt";
+}
+
+void ExpectSameArchitecturalState(EngineState& interpreted, EngineState& threaded)
+{
+    for (auto reg : {Register::A, Register::B, Register::C, Register::D, Register::E, Register::F, Register::H, Register::L})
+        EXPECT_EQ(interpreted.Registers.Read(reg), threaded.Registers.Read(reg));
+
+    for (auto reg : {Register::PC, Register::SP, Register::IX, Register::IY})
+        EXPECT_EQ(interpreted.Registers.ReadPair(reg), threaded.Registers.ReadPair(reg));
+
+    for (auto address = 0x0000; address < 0x2000; ++address)
+        EXPECT_EQ(get<uint8_t>(interpreted.Memory.Read(address, MemoryAccessType::Byte)), get<uint8_t>(threaded.Memory.Read(address, MemoryAccessType::Byte)));
+}
+
+TEST(CoreTests_ThreadedControlUnit, MatchesControlUnitArchitecturalState)
+{
+    vector<uint8_t> program = 
+    {
+        0x3E, 0x00,         // LD A, 0x00
+        0x06, 0x05,         // LD B, 0x05
+        0x21, 0x00, 0x10,   // LD HL, 0x1000
+        0x80,               // ADD A, B
+        0x77,               // LD (HL), A
+        0x23,               // INC HL
+        0x05,               // DEC B
+        0x20, 0xFA,         // JR NZ, -6
+        0xCB, 0x37,         // SWAP A
+        0x76                // HALT
+    };
+
+    EngineState interpreted;
+    EngineState threaded;
+    LoadProgram(interpreted, program);
+    LoadProgram(threaded, program);
+
+    ControlUnit controlUnit;
+    ThreadedControlUnit threadedControlUnit;
+    RunUntilHalt(controlUnit, interpreted);
+    RunUntilHalt(threadedControlUnit, threaded);
+
+    EXPECT_EQ(0xF0, threaded.Registers.Read(Register::A));
+    EXPECT_EQ(0x0F, get<uint8_t>(threaded.Memory.Read(0x1004, MemoryAccessType::Byte)));
+    EXPECT_NE(0llu, threadedControlUnit.BlockCache().Size());
+    ExpectSameArchitecturalState(interpreted, threaded);
+}
+
+TEST(CoreTests_ThreadedControlUnit, SelfModifyingCodeInvalidatesRunningBlock)
+{
+    vector<uint8_t> program = 
+    {
+        0x21, 0x08, 0x00,   // LD HL, 0x0008
+        0x3E, 0x3C,         // LD A, 0x3C (INC A)
+        0x77,               // LD (HL), A
+        0x3E, 0x00,         // LD A, 0x00
+        0x00,               // NOP (overwritten with INC A)
+        0x76                // HALT
+    };
+
+    EngineState interpreted;
+    EngineState threaded;
+    LoadProgram(interpreted, program);
+    LoadProgram(threaded, program);
+
+    ControlUnit controlUnit;
+    ThreadedControlUnit threadedControlUnit;
+    RunUntilHalt(controlUnit, interpreted);
+    RunUntilHalt(threadedControlUnit, threaded);
+
+    EXPECT_EQ(0x01, threaded.Registers.Read(Register::A));
+    ExpectSameArchitecturalState(interpreted, threaded);
+}
+
+TEST(CoreTests_ThreadedControlUnit, BlocksAreInvalidatedByWritesAndBankSwitches)
+{
+    BasicBlockCache cache;
+    auto block = make_shared<BasicBlock>(BasicBlock{true, PrivilegeMode::User, 0x40F0, 0x4110, {}, 0, {}, false});
+    block->Instructions.push_back({nullptr, {}});
+    cache.Insert(block);
+
+    EXPECT_EQ(block, cache.Lookup(PrivilegeMode::User, 0x40F0));
+    EXPECT_EQ(nullptr, cache.Lookup(PrivilegeMode::System, 0x40F0));
+
+    cache.OnWrite(0x4120);
+    EXPECT_TRUE(block->Valid);
+    cache.OnWrite(0x4105);
+    EXPECT_FALSE(block->Valid);
+    EXPECT_EQ(nullptr, cache.Lookup(PrivilegeMode::User, 0x40F0));
+
+    auto bankedBlock = make_shared<BasicBlock>(BasicBlock{true, PrivilegeMode::User, 0x5000, 0x5010, {}, 0, {}, false});
+    bankedBlock->Instructions.push_back({nullptr, {}});
+    cache.Insert(bankedBlock);
+
+    cache.OnBankSwitch(PrivilegeMode::System, AddressRange(0x4000, 0x8000, RangeType::BeginInclusive), 0x01);
+    EXPECT_TRUE(bankedBlock->Valid);
+    cache.OnBankSwitch(PrivilegeMode::User, AddressRange(0x4000, 0x8000, RangeType::BeginInclusive), 0x01);
+    EXPECT_FALSE(bankedBlock->Valid);
+    EXPECT_EQ(0llu, cache.Size());
+
+    auto systemBlock = make_shared<BasicBlock>(BasicBlock{true, PrivilegeMode::System, 0x6000, 0x6010, {}, 0, {}, false});
+    systemBlock->Instructions.push_back({nullptr, {}});
+    cache.Insert(systemBlock);
+
+    cache.OnBankSwitch(PrivilegeMode::Both, AddressRange(0x4000, 0x8000, RangeType::BeginInclusive), 0x02);
+    EXPECT_FALSE(systemBlock->Valid);
+    EXPECT_EQ(0llu, cache.Size());
+}
+
+class ReadCountingRegister : public MemoryMappedRegister
+{
+public:
+    size_t Size() override { return 1; }
+    uint8_t ReadByte() override { ++Reads; return 0x00; }
+    void WriteByte(uint8_t) override {}
+
+    size_t Reads{};
+};
+
+TEST(CoreTests_ThreadedControlUnit, BlocksAreNotTranslatedAheadIntoRegisters)
+{
+    EngineState state;
+    LoadProgram(state, {0x00, 0x00, 0x00, 0x00});
+
+    auto reg = make_unique<ReadCountingRegister>();
+    auto regPointer = reg.get();
+    state.Memory.RegisterMemoryMappedRegister(std::move(reg), 0x0004, PrivilegeMode::Both);
+
+    ThreadedControlUnit threadedControlUnit;
+    threadedControlUnit.Initialize(&state.Memory, &state.ALU);
+    EXPECT_EQ(1llu, threadedControlUnit.RunBounded({1, numeric_limits<uint64_t>::max(), nullptr, nullptr}));
+
+    // The block stops short of the register and of the instructions that could still reach into it
+    auto block = threadedControlUnit.BlockCache().Lookup(PrivilegeMode::System, 0x0000);
+    EXPECT_EQ(0llu, regPointer->Reads);
+    EXPECT_EQ(1llu, block->Instructions.size());
+    EXPECT_EQ(0x0000, block->End);
+}
+
+TEST(CoreTests_ThreadedControlUnit, TieredEngineMatchesControlUnitUnderLockstepValidation)
+{
+    vector<uint8_t> program = 
+    {
+        0x3E, 0x00,         // LD A, 0x00
+        0x06, 0x20,         // LD B, 0x20
+        0x21, 0x00, 0x10,   // LD HL, 0x1000
+        0x80,               // ADD A, B
+        0x77,               // LD (HL), A
+        0x23,               // INC HL
+        0x05,               // DEC B
+        0x20, 0xFA,         // JR NZ, -6
+        0x76                // HALT
+    };
+
+    EngineState interpreted;
+    EngineState tiered;
+    LoadProgram(interpreted, program);
+    LoadProgram(tiered, program);
+
+    ControlUnit controlUnit;
+    TieredControlUnit tieredControlUnit(&tiered.Registers, ExecutionValidation::Lockstep);
+    RunUntilHalt(controlUnit, interpreted);
+    RunUntilHalt(tieredControlUnit, tiered);
+
+    EXPECT_LE(TieredControlUnit::HotBlockThreshold, tieredControlUnit.BlockCache().Lookup(PrivilegeMode::System, 0x0007)->Executions);
+    ExpectSameArchitecturalState(interpreted, tiered);
+}
+
+class ObserverCountingMemoryController : public MemoryController
+{
+public:
+    void RegisterMemoryObserver(MemoryObserver* observer) override
+    {
+        ++Registrations;
+        MemoryController::RegisterMemoryObserver(observer);
+    }
+
+    size_t Registrations{};
+};
+
+TEST(CoreTests_ThreadedControlUnit, LockstepValidationKeepsTheDecodedInstructionCacheAttached)
+{
+    // The block writing to the register is left to the interpreter, the one after it is validated
+    vector<uint8_t> program = 
+    {
+        0x06, 0x10,         // LD B, 0x10
+        0x3E, 0x01,         // LD A, 0x01
+        0xEA, 0x51, 0xFF,   // LD (0xFF51), A
+        0x18, 0x00,         // JR +0
+        0x80,               // ADD A, B
+        0x05,               // DEC B
+        0x20, 0xF5,         // JR NZ, -11
+        0x76                // HALT
+    };
+
+    RegisterBank registers;
+    ObserverCountingMemoryController memory;
+    ArithmeticLogicUnit alu;
+    memory.RegisterMemoryResource(make_unique<RAM>(0x2000), AddressRange(0x0000, 0x2000, RangeType::BeginInclusive), PrivilegeMode::System);
+    memory.RegisterMemoryMappedRegister(make_unique<CGBHDMAAddressRegister>(), 0xFF51, PrivilegeMode::Both);
+    memory.SetSecurityLevel(PrivilegeMode::System);
+
+    for (auto address = 0llu; address < program.size(); ++address)
+        memory.Write(program[address], static_cast<uint16_t>(address));
+
+    alu.Initialize(&registers);
+    TieredControlUnit tieredControlUnit(&registers, ExecutionValidation::Lockstep);
+    tieredControlUnit.Initialize(&memory, &alu);
+
+    for (auto cycle = 0llu; cycle < 0x100 && !alu.HaltSignal(); ++cycle)
+        tieredControlUnit.RunCycle();
+
+    // The block cache and the ALU's decoded instruction cache, each registered once
+    EXPECT_TRUE(alu.HaltSignal());
+    EXPECT_TRUE(tieredControlUnit.BlockCache().Lookup(PrivilegeMode::System, 0x0002)->Interpreted);
+    EXPECT_FALSE(tieredControlUnit.BlockCache().Lookup(PrivilegeMode::System, 0x0009)->Interpreted);
+    EXPECT_EQ(2llu, memory.Registrations);
+}
+
+TEST(CoreTests_ThreadedControlUnit, TieredEngineFallsBackToInterpreterForSelfModifyingCode)
+{
+    vector<uint8_t> program = 
+    {
+        0x21, 0x08, 0x00,   // LD HL, 0x0008
+        0x06, 0x08,         // LD B, 0x08
+        0x3E, 0x3C,         // LD A, 0x3C (INC A)
+        0x77,               // LD (HL), A
+        0x00,               // NOP (overwritten with INC A)
+        0x05,               // DEC B
+        0x20, 0xF9,         // JR NZ, -7
+        0x76                // HALT
+    };
+
+    EngineState interpreted;
+    EngineState tiered;
+    LoadProgram(interpreted, program);
+    LoadProgram(tiered, program);
+
+    ControlUnit controlUnit;
+    TieredControlUnit tieredControlUnit(&tiered.Registers);
+    RunUntilHalt(controlUnit, interpreted);
+    RunUntilHalt(tieredControlUnit, tiered);
+
+    EXPECT_EQ(0x3D, tiered.Registers.Read(Register::A));
+    EXPECT_LE(TieredControlUnit::SelfModifyingCodeThreshold, tieredControlUnit.BlockCache().Overwrites(PrivilegeMode::System, 0x0005));
+    EXPECT_EQ(nullptr, tieredControlUnit.BlockCache().Lookup(PrivilegeMode::System, 0x0005));
+    ExpectSameArchitecturalState(interpreted, tiered);
+}
+
+TEST(CoreTests_ThreadedControlUnit, LockstepValidationDetectsDivergence)
+{
+    vector<uint8_t> program = 
+    {
+        0x3E, 0x01,         // LD A, 0x01
+        0x06, 0x02,         // LD B, 0x02
+        0x18, 0xFA,         // JR -6
+    };
+
+    EngineState tiered;
+    LoadProgram(tiered, program);
+
+    TieredControlUnit tieredControlUnit(&tiered.Registers, ExecutionValidation::Lockstep);
+    tieredControlUnit.Initialize(&tiered.Memory, &tiered.ALU);
+    tieredControlUnit.RunCycle();
+
+    EXPECT_EQ(0x0000, tiered.Registers.ReadPair(Register::PC));
+
+    auto block = tieredControlUnit.BlockCache().Lookup(PrivilegeMode::System, 0x0000);
+    block->Instructions[0].Predecoded.Template.MemoryOperand1 = 0x55;
+
+    ASSERT_THROW(tieredControlUnit.RunCycle(), ControlUnitException);
+}
+
+// Adds an MBC1 cartridge (0x2000-0x7FFF), VRAM, work RAM and the HDMA registers, whose stalls are charged to the ALU
+void AddBankingAndDMA(EngineState& state, uint64_t& stalled)
+{
+    auto rom = make_unique<BankedROM>(4 * 0x4000, 0x4000);
+    auto romPointer = rom.get();
+    auto sourceHigh = make_unique<CGBHDMAAddressRegister>();
+    auto sourceLow = make_unique<CGBHDMAAddressRegister>();
+    auto destinationHigh = make_unique<CGBHDMAAddressRegister>();
+    auto destinationLow = make_unique<CGBHDMAAddressRegister>();
+    auto control = make_unique<CGBHDMAControlRegister>(&state.Memory, [&state, &stalled](uint64_t cycles) { state.ALU.Stall(cycles); stalled += cycles; });
+    control->RegisterAddressRegisters(sourceHigh.get(), sourceLow.get(), destinationHigh.get(), destinationLow.get());
+
+    state.Memory.RegisterMemoryResource(make_unique<ROM>(0x2000), AddressRange(0x2000, 0x4000, RangeType::BeginInclusive), PrivilegeMode::System);
+    state.Memory.RegisterMemoryResource(std::move(rom), AddressRange(0x4000, 0x8000, RangeType::BeginInclusive), PrivilegeMode::System);
+    state.Memory.RegisterMemoryResource(make_unique<RAM>(0x2000), AddressRange(0x8000, 0xA000, RangeType::BeginInclusive), PrivilegeMode::System);
+    state.Memory.RegisterMemoryResource(make_unique<RAM>(0x2000), AddressRange(0xC000, 0xE000, RangeType::BeginInclusive), PrivilegeMode::System);
+    state.Memory.SetMemoryBankController(make_unique<MBC1>(romPointer, nullptr, 0), PrivilegeMode::System);
+    state.Memory.RegisterMemoryMappedRegister(std::move(sourceHigh), 0xFF51, PrivilegeMode::Both);
+    state.Memory.RegisterMemoryMappedRegister(std::move(sourceLow), 0xFF52, PrivilegeMode::Both);
+    state.Memory.RegisterMemoryMappedRegister(std::move(destinationHigh), 0xFF53, PrivilegeMode::Both);
+    state.Memory.RegisterMemoryMappedRegister(std::move(destinationLow), 0xFF54, PrivilegeMode::Both);
+    state.Memory.RegisterMemoryMappedRegister(std::move(control), 0xFF55, PrivilegeMode::Both);
+
+    for (auto offset = 0llu; offset < 0x100; ++offset)
+        state.Memory.Write(static_cast<uint8_t>(offset ^ 0xA5), 0xC000 + offset);
+}
+
+TEST(CoreTests_ThreadedControlUnit, LockstepValidationLeavesSideEffectsAndCyclesUnchanged)
+{
+    vector<uint8_t> program = 
+    {
+        0x06, 0x03,         // LD B, 0x03
+        0x21, 0x00, 0x20,   // LD HL, 0x2000
+        0x3E, 0x00,         // LD A, 0x00
+        0x80,               // ADD A, B
+        0x77,               // LD (HL), A (MBC1 ROM bank)
+        0x21, 0x51, 0xFF,   // LD HL, 0xFF51
+        0x3E, 0xC0,         // LD A, 0xC0
+        0x77,               // LD (HL), A (HDMA1)
+        0x23,               // INC HL
+        0x3E, 0x00,         // LD A, 0x00
+        0x77,               // LD (HL), A (HDMA2)
+        0x23,               // INC HL
+        0x77,               // LD (HL), A (HDMA3)
+        0x23,               // INC HL
+        0x77,               // LD (HL), A (HDMA4)
+        0x23,               // INC HL
+        0x3E, 0x01,         // LD A, 0x01
+        0x77,               // LD (HL), A (HDMA5, two block general purpose transfer)
+        0x05,               // DEC B
+        0x20, 0xE4,         // JR NZ, -28
+        0x76                // HALT
+    };
+
+    array<EngineState, 3> states;
+    array<uint64_t, 3> stalled{};
+    ControlUnit controlUnit;
+    TieredControlUnit tieredControlUnit(&states[1].Registers);
+    TieredControlUnit validatedControlUnit(&states[2].Registers, ExecutionValidation::Lockstep);
+    array<ControlUnitInterface*, 3> controlUnits{&controlUnit, &tieredControlUnit, &validatedControlUnit};
+
+    for (auto engine = 0llu; engine < states.size(); ++engine)
+    {
+        LoadProgram(states[engine], program);
+        AddBankingAndDMA(states[engine], stalled[engine]);
+        RunUntilHalt(*controlUnits[engine], states[engine]);
+    }
+
+    EXPECT_EQ(1llu, states[0].Memory.BankController()->ROMBank());
+    EXPECT_EQ(6 * CGBVideoRAMDMABlockCycles, stalled[0]);
+
+    for (auto engine = 1llu; engine < states.size(); ++engine)
+    {
+        EXPECT_EQ(states[0].ALU.Cycles(), states[engine].ALU.Cycles());
+        EXPECT_EQ(stalled[0], stalled[engine]);
+        EXPECT_EQ(states[0].Memory.BankController()->ROMBank(), states[engine].Memory.BankController()->ROMBank());
+        EXPECT_EQ(0xFF, get<uint8_t>(states[engine].Memory.Read(0xFF55, MemoryAccessType::Byte)));
+
+        for (auto address = 0x8000; address < 0x8040; ++address)
+            EXPECT_EQ(get<uint8_t>(states[0].Memory.Read(address, MemoryAccessType::Byte)), get<uint8_t>(states[engine].Memory.Read(address, MemoryAccessType::Byte)));
+
+        ExpectSameArchitecturalState(states[0], states[engine]);
+    }
+
+    EXPECT_EQ(0xA5, get<uint8_t>(states[2].Memory.Read(0x8000, MemoryAccessType::Byte)));
+    EXPECT_EQ(0x00, get<uint8_t>(states[2].Memory.Read(0x8020, MemoryAccessType::Byte)));
+    EXPECT_TRUE(validatedControlUnit.BlockCache().Lookup(PrivilegeMode::System, 0x0002)->Interpreted);
+}
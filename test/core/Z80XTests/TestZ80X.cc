@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <vector>
+
+#include "CoreTestMocksAndWrappers.h"
+
+#include "AddressRange.h"
+#include "ArithmeticLogicUnit.h"
+#include "Clock.h"
+#include "ControlUnit.h"
+#include "DMGAndGBCRegisterAddresses.h"
+#include "ExecutionEngine.h"
+#include "MemoryController.h"
+#include "OAMDMARegister.h"
+#include "RAM.h"
+#include "RegisterBank.h"
+#include "SystemConstants.h"
+#include "SystemMode.h"
+#include "ThreadedControlUnit.h"
+#include "TieredControlUnit.h"
+#include "Z80X.h"
+
+using namespace std;
+using namespace gbxcore;
+using namespace gbxcore::constants;
+using namespace gbxcore::memory;
+using namespace gbxcore::memory::registers;
+using namespace gbxcore::interfaces;
+using ::testing::NiceMock;
+
+const vector<uint8_t> Z80XCountdownProgram =
+{
+    0x06, 0x05,         // LD B, 0x05
+    0x3E, 0x00,         // LD A, 0x00
+    0x3C,               // INC A
+    0x05,               // DEC B
+    0x20, 0xFC,         // JR NZ, -4
+    0x76                // HALT
+};
+
+template<typename CPU, typename ControlUnitT, typename AluT, typename RegistersT, typename MemoryT>
+RegistersT* InitializeZ80X(CPU& cpu, unique_ptr<ControlUnitT> controlUnit, unique_ptr<AluT> alu)
+{
+    auto memoryController = make_unique<MemoryT>();
+    memoryController->RegisterMemoryResource(make_unique<RAM>(0x2000), AddressRange(0x0000, 0x2000, RangeType::BeginInclusive), PrivilegeMode::System);
+    memoryController->SetSecurityLevel(PrivilegeMode::System);
+
+    for (auto address = 0llu; address < Z80XCountdownProgram.size(); ++address)
+        memoryController->Write(Z80XCountdownProgram[address], static_cast<uint16_t>(address));
+
+    auto registers = make_unique<RegistersT>();
+    auto registersPointer = registers.get();
+
+    cpu.Initialize(std::move(controlUnit), make_unique<Clock>(1), std::move(alu), std::move(memoryController), std::move(registers), make_unique<NiceMock<VideoOutputMock>>());
+    return registersPointer;
+}
+
+const vector<ExecutionEngine> Z80XExecutionEngines = {ExecutionEngine::Interpreter, ExecutionEngine::ThreadedInterpreter, ExecutionEngine::Tiered};
+
+unique_ptr<ControlUnit> CreateZ80XControlUnit(ExecutionEngine engine)
+{
+    switch (engine)
+    {
+        case ExecutionEngine::ThreadedInterpreter: return make_unique<ThreadedControlUnit>();
+        case ExecutionEngine::Tiered: return make_unique<TieredControlUnit>(nullptr);
+        default: return make_unique<ControlUnit>();
+    }
+}
+
+TEST(CoreTests_Z80X, NativeConfigurationRunsProgram)
+{
+    NativeZ80X cpu;
+    auto registers = InitializeZ80X<NativeZ80X, ControlUnit, ArithmeticLogicUnit, RegisterBank, MemoryController>(cpu, make_unique<ControlUnit>(), make_unique<ArithmeticLogicUnit>());
+
+    EXPECT_EQ(StopReason::Halt, cpu.RunInstructions(0x100, nullptr));
+    EXPECT_EQ(0x05, registers->Read(Register::A));
+    EXPECT_EQ(0x00, registers->Read(Register::B));
+}
+
+TEST(CoreTests_Z80X, InterfaceConfigurationAcceptsDecoratedComponents)
+{
+    Z80X<> cpu;
+    auto registers = InitializeZ80X<Z80X<>, ControlUnitInterface, ArithmeticLogicUnitInterface, RegisterBank, MemoryController>(cpu, make_unique<ThreadedControlUnit>(), make_unique<ArithmeticLogicDecorator>());
+
+    EXPECT_EQ(StopReason::Halt, cpu.RunInstructions(0x100, nullptr));
+    EXPECT_EQ(0x05, registers->Read(Register::A));
+    EXPECT_EQ(0x00, registers->Read(Register::B));
+}
+
+TEST(CoreTests_Z80X, BothConfigurationsAccountSameCycles)
+{
+    NativeZ80X native;
+    InitializeZ80X<NativeZ80X, ControlUnit, ArithmeticLogicUnit, RegisterBank, MemoryController>(native, make_unique<ControlUnit>(), make_unique<ArithmeticLogicUnit>());
+
+    Z80X<> interfaced;
+    InitializeZ80X<Z80X<>, ControlUnitInterface, ArithmeticLogicUnitInterface, RegisterBank, MemoryController>(interfaced, make_unique<ControlUnit>(), make_unique<ArithmeticLogicUnit>());
+
+    native.RunInstructions(0x100, nullptr);
+    interfaced.RunInstructions(0x100, nullptr);
+
+    EXPECT_NE(0llu, native.Cycles());
+    EXPECT_EQ(native.Cycles(), interfaced.Cycles());
+}
+
+TEST(CoreTests_Z80X, StalledCyclesAreAccounted)
+{
+    NativeZ80X cpu;
+    InitializeZ80X<NativeZ80X, ControlUnit, ArithmeticLogicUnit, RegisterBank, MemoryController>(cpu, make_unique<ControlUnit>(), make_unique<ArithmeticLogicUnit>());
+
+    cpu.RunInstructions(1, nullptr);
+    auto cycles = cpu.Cycles();
+
+    cpu.Stall(8);
+    EXPECT_EQ(cycles + 8, cpu.Cycles());
+
+    cpu.RunInstructions(1, nullptr);
+    EXPECT_LT(cycles + 8, cpu.Cycles());
+}
+
+TEST(CoreTests_Z80X, ScheduledEventsFireWhenDue)
+{
+    NativeZ80X cpu;
+    InitializeZ80X<NativeZ80X, ControlUnit, ArithmeticLogicUnit, RegisterBank, MemoryController>(cpu, make_unique<ControlUnit>(), make_unique<ArithmeticLogicUnit>());
+    vector<pair<uint64_t, uint64_t>> fired;
+
+    cpu.Scheduler().Schedule(5, [&](uint64_t at) { fired.push_back({at, cpu.Cycles()}); });
+    cpu.Scheduler().Schedule(1000, [&](uint64_t at) { fired.push_back({at, cpu.Cycles()}); });
+
+    EXPECT_EQ(StopReason::Halt, cpu.RunInstructions(0x100, nullptr));
+    ASSERT_EQ(1llu, fired.size());
+    EXPECT_EQ(5llu, fired[0].first);
+    EXPECT_LE(5llu, fired[0].second);
+    EXPECT_EQ(1000llu, cpu.Scheduler().NextEventCycle());
+}
+
+TEST(CoreTests_Z80X, RunInstructionsStopsInsideBlocksOnEveryEngine)
+{
+    vector<uint64_t> cycles;
+
+    for (auto engine : Z80XExecutionEngines)
+    {
+        NativeZ80X cpu;
+        auto registers = InitializeZ80X<NativeZ80X, ControlUnit, ArithmeticLogicUnit, RegisterBank, MemoryController>(cpu, CreateZ80XControlUnit(engine), make_unique<ArithmeticLogicUnit>());
+
+        EXPECT_EQ(StopReason::BudgetExhausted, cpu.RunInstructions(3, nullptr));
+        EXPECT_EQ(0x01, registers->Read(Register::A));
+        EXPECT_EQ(0x05, registers->Read(Register::B));
+        EXPECT_EQ(0x0005, registers->ReadPair(Register::PC));
+
+        EXPECT_EQ(StopReason::BudgetExhausted, cpu.RunInstructions(4, nullptr));
+        EXPECT_EQ(0x02, registers->Read(Register::A));
+        EXPECT_EQ(0x03, registers->Read(Register::B));
+        EXPECT_EQ(0x0006, registers->ReadPair(Register::PC));
+
+        cycles.push_back(cpu.Cycles());
+    }
+
+    EXPECT_EQ(cycles[0], cycles[1]);
+    EXPECT_EQ(cycles[0], cycles[2]);
+}
+
+TEST(CoreTests_Z80X, RunUntilBreakpointStopsInsideBlocksOnEveryEngine)
+{
+    vector<uint64_t> cycles;
+
+    for (auto engine : Z80XExecutionEngines)
+    {
+        NativeZ80X cpu;
+        auto registers = InitializeZ80X<NativeZ80X, ControlUnit, ArithmeticLogicUnit, RegisterBank, MemoryController>(cpu, CreateZ80XControlUnit(engine), make_unique<ArithmeticLogicUnit>());
+        cpu.SetBreakpoint(0x0005);
+
+        EXPECT_EQ(StopReason::Breakpoint, cpu.RunInstructions(0x100, nullptr));
+        EXPECT_EQ(0x01, registers->Read(Register::A));
+        EXPECT_EQ(0x05, registers->Read(Register::B));
+        EXPECT_EQ(0x0005, registers->ReadPair(Register::PC));
+        cycles.push_back(cpu.Cycles());
+
+        EXPECT_EQ(StopReason::Breakpoint, cpu.RunFor(0x1000, nullptr));
+        EXPECT_EQ(0x02, registers->Read(Register::A));
+        EXPECT_EQ(0x04, registers->Read(Register::B));
+        EXPECT_EQ(0x0005, registers->ReadPair(Register::PC));
+
+        cpu.ClearBreakpoint(0x0005);
+
+        EXPECT_EQ(StopReason::Halt, cpu.RunInstructions(0x100, nullptr));
+        EXPECT_EQ(0x05, registers->Read(Register::A));
+        EXPECT_EQ(0x00, registers->Read(Register::B));
+    }
+
+    EXPECT_EQ(cycles[0], cycles[1]);
+    EXPECT_EQ(cycles[0], cycles[2]);
+}
+
+TEST(CoreTests_Z80X, ScheduledEventsFireAtTheSameCycleOnEveryEngine)
+{
+    vector<uint64_t> fired;
+
+    for (auto engine : Z80XExecutionEngines)
+    {
+        NativeZ80X cpu;
+        InitializeZ80X<NativeZ80X, ControlUnit, ArithmeticLogicUnit, RegisterBank, MemoryController>(cpu, CreateZ80XControlUnit(engine), make_unique<ArithmeticLogicUnit>());
+
+        cpu.Scheduler().Schedule(5, [&](uint64_t) { fired.push_back(cpu.Cycles()); });
+
+        EXPECT_EQ(StopReason::Halt, cpu.RunInstructions(0x100, nullptr));
+    }
+
+    ASSERT_EQ(3llu, fired.size());
+    EXPECT_EQ(fired[0], fired[1]);
+    EXPECT_EQ(fired[0], fired[2]);
+}
+
+TEST(CoreTests_Z80X, OAMDMAStartedInsideABlockUsesTheCycleOfTheWrite)
+{
+    const vector<uint8_t> program =
+    {
+        0x00,               // NOP
+        0x00,               // NOP
+        0x3E, 0xC0,         // LD A, 0xC0
+        0xEA, 0x46, 0xFF,   // LD (0xFF46), A
+        0x00,               // NOP
+        0x76                // HALT
+    };
+
+    vector<uint64_t> transferEnds;
+
+    for (auto engine : Z80XExecutionEngines)
+    {
+        NativeZ80X cpu;
+        auto memoryController = make_unique<MemoryController>();
+        memoryController->RegisterMemoryResource(make_unique<RAM>(0x2000), AddressRange(0x0000, 0x2000, RangeType::BeginInclusive), PrivilegeMode::System);
+        memoryController->RegisterMemoryResource(make_unique<RAM>(0x2000), AddressRange(0xC000, 0xE000, RangeType::BeginInclusive), PrivilegeMode::System);
+        memoryController->RegisterMemoryResource(make_unique<RAM>(DMGBCOAMPhysicalSize), AddressRange(DMGBCOAMInitialAddress, DMGBCOAMFinalAddress, RangeType::BeginInclusive), PrivilegeMode::System);
+        memoryController->RegisterMemoryResource(make_unique<RAM>(DMGBCHRAMPhysicalSize), AddressRange(DMGBCHRAMInitialAddress, DMGBCHRAMFinalAddress, RangeType::BeginInclusive), PrivilegeMode::System);
+        memoryController->SetSecurityLevel(PrivilegeMode::System);
+
+        auto dma = make_unique<OAMDMARegister>(memoryController.get(), [&cpu]() { return cpu.Cycles(); });
+        auto dmaPointer = dma.get();
+        memoryController->RegisterMemoryMappedRegister(std::move(dma), OAMDMARegisterAddress, PrivilegeMode::Both);
+
+        for (auto address = 0llu; address < program.size(); ++address)
+            memoryController->Write(program[address], static_cast<uint16_t>(address));
+
+        cpu.Initialize(CreateZ80XControlUnit(engine), make_unique<Clock>(1), make_unique<ArithmeticLogicUnit>(), std::move(memoryController), make_unique<RegisterBank>(), make_unique<NiceMock<VideoOutputMock>>());
+
+        EXPECT_EQ(StopReason::BudgetExhausted, cpu.RunInstructions(4, nullptr));
+        EXPECT_LT(DMGBCOAMDMATransferCycles, dmaPointer->TransferEnd());
+        EXPECT_EQ(cpu.Cycles() + DMGBCOAMDMATransferCycles, dmaPointer->TransferEnd());
+        transferEnds.push_back(dmaPointer->TransferEnd());
+    }
+
+    EXPECT_EQ(transferEnds[0], transferEnds[1]);
+    EXPECT_EQ(transferEnds[0], transferEnds[2]);
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "RAM.h"
+#include "ZeroPages.h"
+
+using namespace std;
+using namespace gbxcore::memory;
+
+TEST(CoreTests_ZeroPages, MappedAndSmallBlocksAreZeroedAndWritable)
+{
+    for (auto size : {static_cast<size_t>(0x10), ZeroPagesMappingThreshold, static_cast<size_t>(0x200000)})
+    {
+        auto block = AllocateZeroPages<uint8_t>(size);
+
+        EXPECT_TRUE(all_of(block.get(), block.get() + size, [](auto byte) { return byte == 0x00; }));
+
+        block[0] = 0xAA;
+        block[size - 1] = 0x55;
+        EXPECT_EQ(0xAA, block[0]);
+        EXPECT_EQ(0x55, block[size - 1]);
+    }
+}
+
+TEST(CoreTests_ZeroPages, EmptyBlock)
+{
+    auto block = AllocateZeroPages<uint8_t>(0);
+    EXPECT_EQ(nullptr, block.get());
+}
+
+TEST(CoreTests_ZeroPages, LargeRAMStartsZeroed)
+{
+    RAM ram(0x200000);
+
+    EXPECT_EQ(0x00, ram.ReadByte(0x000000));
+    EXPECT_EQ(0x0000, ram.ReadWord(0x1FFFFE));
+
+    ram.WriteWord(0xBEEF, 0x100000);
+    EXPECT_EQ(0xBEEF, ram.ReadWord(0x100000));
+}
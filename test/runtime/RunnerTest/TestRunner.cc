@@ -7,23 +7,49 @@
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <string>
 #include <thread> 
 #include <variant> 
 
 #include "CancellationToken.h"
+#include "GBXEmulatorExceptions.h"
 #include "Runner.h"
 #include "Runtime.h"
 #include "RegisterBankInterface.h"
 
 using namespace std;
 using namespace std::chrono_literals;
-using namespace gbxruntime::runner;
+using namespace gbxruntime;
 using namespace gbxruntime::runner;
 using namespace gbxcore::interfaces;
 
 using ::testing::Return;
+using ::testing::ReturnRef;
 using ::testing::_;
 
+StopReason RunUntilCancelled(CancellationCheck isCancelled)
+{
+    while (!isCancelled())
+        std::this_thread::sleep_for(1ms);
+
+    return StopReason::Cancelled;
+}
+
+void CountExecutedInstructions(RuntimeMock& runtime, uint64_t& instructions)
+{
+    EXPECT_CALL(runtime, Instructions()).WillRepeatedly([&instructions]() { return instructions; });
+}
+
+auto ExecuteInstructions(uint64_t& instructions, StopReason reason, optional<uint64_t> executed = nullopt)
+{
+    return [&instructions, reason, executed](uint64_t count, CancellationCheck) 
+    {
+        instructions += executed.value_or(count);
+        return reason;
+    };
+}
+
 TEST(RuntimeTests_Runner, Construction) 
 {
     auto runtime = make_shared<RuntimeMock>();
@@ -39,11 +65,12 @@ TEST(RuntimeTests_Runner, RunForANumberOfCycles)
     auto pointer = static_pointer_cast<Runtime>(runtime);
     auto runner = make_shared<Runner>(pointer);
 
-    EXPECT_CALL((*runtime), Run()).Times(100);
+    uint64_t instructions = 0;
+    CountExecutedInstructions(*runtime, instructions);
+
+    EXPECT_CALL((*runtime), RunInstructions(100, _)).Times(2).WillRepeatedly(ExecuteInstructions(instructions, StopReason::BudgetExhausted));
     CancellationToken token;
     runner->Run(100, token);
-    
-    EXPECT_CALL((*runtime), Run()).Times(100);
     runner->Run(100, token);
 
     EXPECT_EQ(RunnerMode::Runtime, runner->Mode());
@@ -62,7 +89,8 @@ TEST(RuntimeTests_Runner, CancellationAWithPredefinedNumberOfCycles)
         token.Cancel();
     });
 
-    EXPECT_CALL((*runtime), Run()).WillRepeatedly(Return());
+    EXPECT_CALL((*runtime), Instructions()).WillRepeatedly(Return(0));
+    EXPECT_CALL((*runtime), RunInstructions(_, _)).WillRepeatedly([](uint64_t, CancellationCheck isCancelled) { return RunUntilCancelled(isCancelled); });
     runner->Run(numeric_limits<size_t>::max(), token);
     
     cancellationThread.join();
@@ -83,10 +111,100 @@ TEST(RuntimeTests_Runner, RunIndefinitelyWithCancellationToken)
         token.Cancel();
     });
 
-    EXPECT_CALL((*runtime), Run()).WillRepeatedly(Return());
+    EXPECT_CALL((*runtime), RunFrame(_)).WillRepeatedly([](CancellationCheck isCancelled) { return RunUntilCancelled(isCancelled); });
     runner->Run(token);
 
     cancellationThread.join();
     EXPECT_TRUE(token.IsCancelled());
     EXPECT_EQ(RunnerMode::Runtime, runner->Mode());
+}
+
+TEST(RuntimeTests_Runner, RunLargeNumberOfCyclesInBatches) 
+{
+    auto runtime = make_shared<RuntimeMock>();
+    auto pointer = static_pointer_cast<Runtime>(runtime);
+    auto runner = make_shared<Runner>(pointer);
+
+    uint64_t instructions = 0;
+    CountExecutedInstructions(*runtime, instructions);
+
+    EXPECT_CALL((*runtime), RunInstructions(0x10000, _)).Times(2).WillRepeatedly(ExecuteInstructions(instructions, StopReason::BudgetExhausted));
+    EXPECT_CALL((*runtime), RunInstructions(0x20, _)).Times(1).WillOnce(ExecuteInstructions(instructions, StopReason::BudgetExhausted));
+    CancellationToken token;
+    runner->Run(0x20020, token);
+
+    EXPECT_EQ(0x20020u, instructions);
+}
+
+TEST(RuntimeTests_Runner, HaltedBatchesOnlyCountExecutedInstructions) 
+{
+    auto runtime = make_shared<RuntimeMock>();
+    auto pointer = static_pointer_cast<Runtime>(runtime);
+    auto runner = make_shared<Runner>(pointer);
+
+    uint64_t instructions = 0;
+    CountExecutedInstructions(*runtime, instructions);
+
+    EXPECT_CALL((*runtime), RunInstructions(0x10000, _)).Times(2)
+        .WillOnce(ExecuteInstructions(instructions, StopReason::Halt, 0x100))
+        .WillOnce(ExecuteInstructions(instructions, StopReason::BudgetExhausted));
+    EXPECT_CALL((*runtime), RunInstructions(0xFF00, _)).Times(1).WillOnce(ExecuteInstructions(instructions, StopReason::BudgetExhausted));
+    CancellationToken token;
+    runner->Run(0x20000, token);
+
+    EXPECT_EQ(0x20000u, instructions);
+}
+
+TEST(RuntimeTests_Runner, StopRunningWhenBreakpointIsHit) 
+{
+    auto runtime = make_shared<RuntimeMock>();
+    auto pointer = static_pointer_cast<Runtime>(runtime);
+    auto runner = make_shared<Runner>(pointer);
+
+    EXPECT_CALL((*runtime), RunFrame(_)).Times(3)
+        .WillOnce(Return(StopReason::BudgetExhausted))
+        .WillOnce(Return(StopReason::Halt))
+        .WillOnce(Return(StopReason::Breakpoint));
+    CancellationToken token;
+    runner->Run(token);
+
+    EXPECT_FALSE(token.IsCancelled());
+}
+
+TEST(RuntimeTests_Runner, StopRunningForANumberOfCyclesWhenBreakpointIsHit) 
+{
+    auto runtime = make_shared<RuntimeMock>();
+    auto pointer = static_pointer_cast<Runtime>(runtime);
+    auto runner = make_shared<Runner>(pointer);
+
+    uint64_t instructions = 0;
+    CountExecutedInstructions(*runtime, instructions);
+
+    EXPECT_CALL((*runtime), RunInstructions(0x10000, _)).Times(3)
+        .WillOnce(ExecuteInstructions(instructions, StopReason::BudgetExhausted))
+        .WillOnce(ExecuteInstructions(instructions, StopReason::Halt, 0x10))
+        .WillOnce(ExecuteInstructions(instructions, StopReason::Breakpoint, 0x20));
+    CancellationToken token;
+    runner->Run(0x100000, token);
+
+    EXPECT_FALSE(token.IsCancelled());
+}
+
+TEST(RuntimeTests_Runner, ReportCoreErrors) 
+{
+    auto runtime = make_shared<RuntimeMock>();
+    auto pointer = static_pointer_cast<Runtime>(runtime);
+    auto runner = make_shared<Runner>(pointer);
+    string error = "illegal instruction executed";
+
+    uint64_t instructions = 0;
+    CountExecutedInstructions(*runtime, instructions);
+
+    EXPECT_CALL((*runtime), LastError()).WillRepeatedly(ReturnRef(error));
+    EXPECT_CALL((*runtime), RunFrame(_)).WillOnce(Return(StopReason::Error));
+    EXPECT_CALL((*runtime), RunInstructions(0x100, _)).WillOnce(ExecuteInstructions(instructions, StopReason::Error, 0x10));
+    CancellationToken token;
+
+    ASSERT_THROW(runner->Run(token), GBXEmulatorExceptions);
+    ASSERT_THROW(runner->Run(0x100, token), GBXEmulatorExceptions);
 }
\ No newline at end of file
@@ -25,10 +25,13 @@ public:
     MOCK_METHOD(gbxcore::SecurityLevel, SecurityLevel, ());
     MOCK_METHOD(void, Write, ((std::variant<uint8_t, uint16_t>), size_t));
     MOCK_METHOD(void, Load, ((std::unique_ptr<uint8_t*>), size_t, size_t, (std::optional<size_t>)));
+    MOCK_METHOD(void, Map, ((std::shared_ptr<const uint8_t>), size_t, size_t));
     MOCK_METHOD(size_t, RegisterMemoryResource, ((std::unique_ptr<gbxcore::interfaces::MemoryResource>), gbxcore::AddressRange, gbxcore::PrivilegeMode));
     MOCK_METHOD(void, UnregisterMemoryResource, (size_t, gbxcore::PrivilegeMode));
     MOCK_METHOD(void, RegisterMemoryMappedRegister, ((std::unique_ptr<gbxcore::interfaces::MemoryMappedRegister>), size_t, gbxcore::PrivilegeMode));
     MOCK_METHOD(void, UnregisterMemoryMappedRegister, (size_t, gbxcore::PrivilegeMode));
+    MOCK_METHOD(void, RegisterMemoryObserver, (gbxcore::interfaces::MemoryObserver*));
+    MOCK_METHOD(void, UnregisterMemoryObserver, (gbxcore::interfaces::MemoryObserver*));
 };
 
 class VideoControllerMock : public gbxcore::interfaces::VideoControllerInterface
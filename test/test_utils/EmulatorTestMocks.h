@@ -19,6 +19,14 @@ class RuntimeMock : public gbxcore::interfaces::Runtime
 public:
     virtual ~RuntimeMock() = default;
     MOCK_METHOD(void, Run, ());
+    MOCK_METHOD(gbxcore::interfaces::StopReason, RunFor, (uint64_t, gbxcore::interfaces::CancellationCheck));
+    MOCK_METHOD(gbxcore::interfaces::StopReason, RunInstructions, (uint64_t, gbxcore::interfaces::CancellationCheck));
+    MOCK_METHOD(gbxcore::interfaces::StopReason, RunFrame, (gbxcore::interfaces::CancellationCheck));
+
+    MOCK_METHOD(void, SetBreakpoint, (uint16_t));
+    MOCK_METHOD(void, ClearBreakpoint, (uint16_t));
+    MOCK_METHOD(const std::string&, LastError, (), (const));
+    MOCK_METHOD(uint64_t, Instructions, (), (const));
     
     MOCK_METHOD(gbxcore::SecurityLevel, SecurityLevel, ());
     MOCK_METHOD(void, SetSecurityLevel, (gbxcore::SecurityLevel));